@@ -0,0 +1,462 @@
+// runs the same workloads through akr::BigInt, boost::multiprecision::cpp_int and, when D_AKR_BENCH_GMP is
+// defined and -lgmp is linked, GMP, and prints a table of the times and of BigInt's ratio to each.
+//
+//   build.bat g++ -O2
+//   build.bat g++ "-O2 -DD_AKR_BENCH_GMP -lgmp"
+//   out\bigint_benchg++-O2.exe [largest size in bits, 10000000 by default] [operation]
+
+#include "../bigint.hh"
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#ifdef  D_AKR_BENCH_GMP
+#include <gmp.h>
+#endif//D_AKR_BENCH_GMP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // the operands of one size, as hex digits every library can read.
+    struct Operands final
+    {
+        std::size_t bits;
+
+        std::string lhs;
+
+        std::string rhs;
+
+        std::string decimal;
+    };
+
+    struct AkrLib final
+    {
+        using T = akr::BigInt;
+
+        static constexpr auto Name = "BigInt";
+
+        static auto FromHex(const std::string& hex) -> T
+        {
+            return T(hex, 16);
+        }
+
+        static auto Parse(const std::string& decimal) -> T
+        {
+            return T(decimal);
+        }
+
+        static auto Print(const T& value) -> std::string
+        {
+            return value.ToStdString();
+        }
+
+        static auto Pow(unsigned base, std::size_t exponent) -> T
+        {
+            return akr::pow(T(base), T(exponent));
+        }
+
+        static auto Bitwise(const T& lhs, const T& rhs) -> T
+        {
+            return (lhs & rhs) ^ (lhs | rhs);
+        }
+
+        static auto Hash(const T& value) -> std::size_t
+        {
+            return value.bit_length();
+        }
+    };
+
+    struct BoostLib final
+    {
+        using T = boost::multiprecision::cpp_int;
+
+        static constexpr auto Name = "cpp_int";
+
+        static auto FromHex(const std::string& hex) -> T
+        {
+            return T("0x" + hex);
+        }
+
+        static auto Parse(const std::string& decimal) -> T
+        {
+            return T(decimal);
+        }
+
+        static auto Print(const T& value) -> std::string
+        {
+            return value.str();
+        }
+
+        static auto Pow(unsigned base, std::size_t exponent) -> T
+        {
+            return boost::multiprecision::pow(T(base), static_cast<unsigned>(exponent));
+        }
+
+        static auto Bitwise(const T& lhs, const T& rhs) -> T
+        {
+            return T((lhs & rhs) ^ (lhs | rhs));
+        }
+
+        static auto Hash(const T& value) -> std::size_t
+        {
+            return value == 0 ? 0 : boost::multiprecision::msb(value) + 1;
+        }
+    };
+
+    #ifdef  D_AKR_BENCH_GMP
+    // a minimal owning wrapper, so the workloads read the same as for the other two.
+    struct Mpz final
+    {
+        mpz_t value;
+
+        Mpz()
+        {
+            mpz_init(value);
+        }
+
+        Mpz(const Mpz& other)
+        {
+            mpz_init_set(value, other.value);
+        }
+
+        auto operator=(const Mpz& other) -> Mpz&
+        {
+            mpz_set(value, other.value);
+
+            return *this;
+        }
+
+        ~Mpz()
+        {
+            mpz_clear(value);
+        }
+
+        friend auto operator+(const Mpz& lhs, const Mpz& rhs) -> Mpz
+        {
+            auto ret = Mpz();
+
+            mpz_add(ret.value, lhs.value, rhs.value);
+
+            return ret;
+        }
+
+        friend auto operator*(const Mpz& lhs, const Mpz& rhs) -> Mpz
+        {
+            auto ret = Mpz();
+
+            mpz_mul(ret.value, lhs.value, rhs.value);
+
+            return ret;
+        }
+
+        friend auto operator/(const Mpz& lhs, const Mpz& rhs) -> Mpz
+        {
+            auto ret = Mpz();
+
+            mpz_tdiv_q(ret.value, lhs.value, rhs.value);
+
+            return ret;
+        }
+
+        friend auto operator%(const Mpz& lhs, const Mpz& rhs) -> Mpz
+        {
+            auto ret = Mpz();
+
+            mpz_tdiv_r(ret.value, lhs.value, rhs.value);
+
+            return ret;
+        }
+    };
+
+    struct GmpLib final
+    {
+        using T = Mpz;
+
+        static constexpr auto Name = "GMP";
+
+        static auto FromHex(const std::string& hex) -> T
+        {
+            auto ret = T();
+
+            mpz_set_str(ret.value, hex.c_str(), 16);
+
+            return ret;
+        }
+
+        static auto Parse(const std::string& decimal) -> T
+        {
+            auto ret = T();
+
+            mpz_set_str(ret.value, decimal.c_str(), 10);
+
+            return ret;
+        }
+
+        static auto Print(const T& value) -> std::string
+        {
+            auto ret = std::string(mpz_sizeinbase(value.value, 10) + 1, '\0');
+
+            mpz_get_str(ret.data(), 10, value.value);
+
+            ret.resize(std::char_traits<char>::length(ret.c_str()));
+
+            return ret;
+        }
+
+        static auto Pow(unsigned base, std::size_t exponent) -> T
+        {
+            auto ret = T();
+
+            mpz_ui_pow_ui(ret.value, base, exponent);
+
+            return ret;
+        }
+
+        static auto Bitwise(const T& lhs, const T& rhs) -> T
+        {
+            auto both   = T();
+            auto either = T();
+            auto ret    = T();
+
+            mpz_and(both.value, lhs.value, rhs.value);
+            mpz_ior(either.value, lhs.value, rhs.value);
+            mpz_xor(ret.value, both.value, either.value);
+
+            return ret;
+        }
+
+        static auto Hash(const T& value) -> std::size_t
+        {
+            return mpz_sgn(value.value) == 0 ? 0 : mpz_sizeinbase(value.value, 2);
+        }
+    };
+    #endif//D_AKR_BENCH_GMP
+
+    // the seconds one call of func takes, averaged over enough calls to last 20ms, the best of three such runs.
+    // a single call that takes longer than a second is not repeated.
+    auto Measure(const std::function<void()>& func) -> double
+    {
+        using namespace std::chrono;
+
+        auto best = 1e300;
+
+        for (auto run = 0; run < 3; run++)
+        {
+            for (auto count = 1zu;; count *= 2)
+            {
+                const auto t1 = steady_clock::now();
+
+                for (auto i = 0zu; i < count; i++)
+                {
+                    func();
+                }
+
+                const auto t2 = steady_clock::now();
+
+                if (const auto elapsed = duration<double>(t2 - t1).count(); elapsed >= 0.02)
+                {
+                    best = std::min(best, elapsed / static_cast<double>(count));
+
+                    if (elapsed >= 1.0)
+                    {
+                        return best;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        return best;
+    }
+
+    // an operation by name and its setup, which builds the operands it needs beyond lhs and rhs and returns the call
+    // to time. It runs only when the operation is timed, so skipped ones cost nothing, and never inside Measure.
+    using Workload = std::pair<std::string, std::function<std::function<void()>()>>;
+
+    // the operations in the order they are printed, each timed on the operands of one size.
+    template<class L>
+    auto Workloads(const Operands& operands) -> std::vector<Workload>
+    {
+        using T = typename L::T;
+
+        const auto lhs      = L::FromHex(operands.lhs);
+        const auto rhs      = L::FromHex(operands.rhs);
+
+        // 3^exponent has about as many bits as the operands.
+        const auto exponent = static_cast<std::size_t>(static_cast<double>(operands.bits) / std::log2(3.0));
+
+        auto sink = std::make_shared<std::size_t>(0);
+
+        return
+        {
+            { "add",     [=] { return [=] { *sink += L::Hash(T(lhs + rhs)); }; } },
+            { "mul",     [=] { return [=] { *sink += L::Hash(T(lhs * rhs)); }; } },
+            { "divmod",  [=]
+                         {
+                             const auto product_ = T(lhs * rhs);
+
+                             return [=] { *sink += L::Hash(T(product_ / rhs)) + L::Hash(T(product_ % rhs)); };
+                         } },
+            { "pow",     [=] { return [=] { *sink += L::Hash(L::Pow(3, exponent)); }; } },
+            { "parse",   [=] { return [=] { *sink += L::Hash(L::Parse(operands.decimal)); }; } },
+            { "print",   [=]
+                         {
+                             const auto value_ = L::Parse(operands.decimal);
+
+                             return [=] { *sink += L::Print(value_).size(); };
+                         } },
+            { "bitwise", [=] { return [=] { *sink += L::Hash(L::Bitwise(lhs, rhs)); }; } },
+        };
+    }
+
+    struct Column final
+    {
+        std::string name;
+
+        std::function<std::vector<Workload>(const Operands&)> workloads;
+
+        // operations that already took longer than this are not run at larger sizes.
+        std::map<std::string, bool> isSlow;
+    };
+
+    auto Format(double seconds) -> std::string
+    {
+        auto buffer = std::array<char, 32> {};
+
+        if (seconds < 1e-3)
+        {
+            std::snprintf(buffer.data(), buffer.size(), "%8.3fus", seconds * 1e6);
+        }
+        else if (seconds < 1)
+        {
+            std::snprintf(buffer.data(), buffer.size(), "%8.3fms", seconds * 1e3);
+        }
+        else
+        {
+            std::snprintf(buffer.data(), buffer.size(), "%8.3fs ", seconds);
+        }
+
+        return buffer.data();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto maxBits = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000ull;
+
+    const auto only = std::string(argc > 2 ? argv[2] : "");
+
+    auto columns = std::vector<Column>
+    {
+        { AkrLib  ::Name, Workloads<AkrLib>,   {} },
+        { BoostLib::Name, Workloads<BoostLib>, {} },
+        #ifdef  D_AKR_BENCH_GMP
+        { GmpLib  ::Name, Workloads<GmpLib>,   {} },
+        #endif//D_AKR_BENCH_GMP
+    };
+
+    std::printf("kernels: %s\n\n", std::string(akr::active_kernels()).c_str());
+
+    std::printf("%-8s %10s", "op", "bits");
+
+    for (auto&& e : columns)
+    {
+        std::printf(" %10s", e.name.c_str());
+    }
+
+    for (auto i = 1zu; i < columns.size(); i++)
+    {
+        std::printf(" %10s", ("/" + columns[i].name).c_str());
+    }
+
+    std::printf("\n");
+
+    auto re = std::mt19937_64(2022);
+
+    for (auto bits = 64ull; bits <= maxBits; bits = bits * 4 <= maxBits || bits == maxBits ? bits * 4 : maxBits)
+    {
+        const auto hex_ = [&](std::size_t bits_)
+        {
+            auto ret_ = std::string(1, "89ABCDEF"[re() % 8]);
+
+            for (auto i_ = 4zu; i_ < bits_; i_ += 4)
+            {
+                ret_.push_back("0123456789ABCDEF"[re() % 16]);
+            }
+
+            return ret_;
+        };
+
+        auto operands = Operands { bits, hex_(bits), hex_(bits / 2 + 4), "" };
+
+        operands.decimal = akr::BigInt(operands.lhs, 16).ToStdString();
+
+        auto tables = std::vector<std::vector<Workload>>();
+
+        for (auto&& e : columns)
+        {
+            tables.push_back(e.workloads(operands));
+        }
+
+        for (auto op = 0zu; op < tables[0].size(); op++)
+        {
+            const auto& name = tables[0][op].first;
+
+            if (!only.empty() && name != only)
+            {
+                continue;
+            }
+
+            auto times = std::vector<double>();
+
+            for (auto i = 0zu; i < columns.size(); i++)
+            {
+                auto&& isSlow = columns[i].isSlow[name];
+
+                times.push_back(isSlow ? -1 : Measure(tables[i][op].second()));
+
+                isSlow = isSlow || times.back() > 2.0;
+            }
+
+            std::printf("%-8s %10llu", name.c_str(), bits);
+
+            for (auto&& e : times)
+            {
+                std::printf(" %10s", e < 0 ? "-" : Format(e).c_str());
+            }
+
+            for (auto i = 1zu; i < times.size(); i++)
+            {
+                if (times[0] < 0 || times[i] < 0)
+                {
+                    std::printf(" %10s", "-");
+                }
+                else
+                {
+                    std::printf(" %10.2f", times[0] / times[i]);
+                }
+            }
+
+            std::printf("\n");
+
+            std::fflush(stdout);
+        }
+
+        if (bits == maxBits)
+        {
+            break;
+        }
+    }
+}
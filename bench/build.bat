@@ -0,0 +1 @@
+%1 "bigint_bench.cc" -o"./out/bigint_bench%1%2.exe" -Wall -Wextra -std="c++2b" %2
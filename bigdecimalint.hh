@@ -0,0 +1,812 @@
+#ifndef Z_AKR_BIGDECIMALINT_HH
+#define Z_AKR_BIGDECIMALINT_HH
+
+#include "bigint.hh"
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <locale>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#ifndef D_AKR_BIGDECIMALINT_MUL_KARATSUBA
+#define D_AKR_BIGDECIMALINT_MUL_KARATSUBA 48
+#endif//D_AKR_BIGDECIMALINT_MUL_KARATSUBA
+
+namespace akr::detail
+{
+    // the limbs of BigDecimalInt hold DecimalDigits digits each, the most a limb has room for, 10^19 for 64 bits.
+    inline constexpr auto DecimalBase   = []
+                                          {
+                                              auto ret_ = Limb(1);
+
+                                              for (; ret_ <= std::numeric_limits<Limb>::max() / 10;)
+                                              {
+                                                  ret_ *= 10;
+                                              }
+
+                                              return ret_;
+                                          }();
+
+    inline constexpr auto DecimalDigits = static_cast<std::size_t>(std::numeric_limits<Limb>::digits10);
+
+    // (hi:lo) / DecimalBase for hi < DecimalBase. 10^19 has its top bit set, so its reciprocal serves as it is.
+    constexpr auto dec_div(Limb hi, Limb lo, Limb& rem) noexcept -> Limb
+    {
+        if constexpr (std::countl_zero(DecimalBase) == 0)
+        {
+            constexpr auto reciprocal = reciprocal_limb(DecimalBase);
+
+            return div_preinv(hi, lo, DecimalBase, reciprocal, rem);
+        }
+        else
+        {
+            return div_wide(hi, lo, DecimalBase, rem);
+        }
+    }
+
+    constexpr auto dec_add_1(Limb* rp, const Limb* ap, std::size_t n, Limb carry) noexcept -> Limb
+    {
+        for (auto i = 0zu; i < n; i++)
+        {
+            const auto sum = ap[i] + carry;
+
+            carry = sum >= DecimalBase;
+
+            rp[i] = carry != 0 ? sum - DecimalBase : sum;
+        }
+
+        return carry;
+    }
+
+    // rp[0, an) = ap[0, an) + bp[0, bn) in base DecimalBase, requires an >= bn.
+    constexpr auto dec_add(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept -> Limb
+    {
+        auto carry = Limb(0);
+
+        for (auto i = 0zu; i < bn; i++)
+        {
+            const auto b   = bp[i] + carry;
+            const auto sum = ap[i] + b;
+
+            // twice 10^19 passes 2^64, a sum that wraps has passed the base as well.
+            carry = sum < b || sum >= DecimalBase;
+
+            rp[i] = carry != 0 ? sum - DecimalBase : sum;
+        }
+
+        return dec_add_1(rp + bn, ap + bn, an - bn, carry);
+    }
+
+    // rp[0, an) = ap[0, an) - bp[0, bn) in base DecimalBase, requires an >= bn.
+    constexpr auto dec_sub(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept -> Limb
+    {
+        auto borrow = Limb(0);
+
+        for (auto i = 0zu; i < an; i++)
+        {
+            const auto a = ap[i];
+            const auto b = (i < bn ? bp[i] : 0) + borrow;
+
+            borrow = a < b;
+
+            rp[i] = borrow != 0 ? a + DecimalBase - b : a - b;
+        }
+
+        return borrow;
+    }
+
+    // rp[0, an + bn) = ap[0, an) * bp[0, bn) column by column: the products of a column are summed in three limbs
+    // and split by the base once, rather than once for every product as a row by row product would.
+    constexpr void dec_mul_basecase(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept
+    {
+        auto c0 = Limb(0);
+        auto c1 = Limb(0);
+
+        for (auto k = 0zu; k + 1 < an + bn; k++)
+        {
+            auto t0 = c0;
+            auto t1 = c1;
+            auto t2 = Limb(0);
+
+            for (auto i = k >= bn ? k - bn + 1 : 0; i <= std::min(k, an - 1); i++)
+            {
+                auto hi = Limb(0);
+
+                const auto lo = mul_wide(ap[i], bp[k - i], hi);
+
+                t0 += lo;
+                hi += t0 < lo;
+
+                t1 += hi;
+                t2 += t1 < hi;
+            }
+
+            auto rem = Limb(0);
+
+            c1 = dec_div(t2, t1, rem);
+            c0 = dec_div(rem, t0, rem);
+
+            rp[k] = rem;
+        }
+
+        rp[an + bn - 1] = c0;
+    }
+
+    inline void dec_mul(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn);
+
+    // the Karatsuba step of mul_karatsuba on decimal limbs, requires an >= bn > h = ceil(an / 2).
+    inline void dec_mul_karatsuba(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        const auto h = (an + 1) / 2;
+
+        auto sa = Nat(h + 1);
+        auto sb = Nat(h + 1);
+
+        sa[h] = dec_add(sa.data(), ap, h, ap + h, an - h);
+        sb[h] = dec_add(sb.data(), bp, h, bp + h, bn - h);
+
+        auto z1 = Nat((h + 1) * 2);
+
+        fork_join(an, [&]
+                  {
+                      dec_mul(rp, ap, h, bp, h);
+                  },
+                  [&]
+                  {
+                      fork_join(an, [&]
+                                {
+                                    dec_mul(rp + h * 2, ap + h, an - h, bp + h, bn - h);
+                                },
+                                [&]
+                                {
+                                    dec_mul(z1.data(), sa.data(), h + 1, sb.data(), h + 1);
+                                });
+                  });
+
+        dec_sub(z1.data(), z1.data(), z1.size(), rp, h * 2);
+        dec_sub(z1.data(), z1.data(), z1.size(), rp + h * 2, an + bn - h * 2);
+
+        dec_add(rp + h, rp + h, an + bn - h, z1.data(), normalized_size(z1.data(), z1.size()));
+    }
+
+    // rp[0, an + bn) = ap[0, an) * bp[0, bn) in base DecimalBase, rp must not overlap the operands.
+    inline void dec_mul(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        if (an < bn)
+        {
+            std::swap(ap, bp);
+            std::swap(an, bn);
+        }
+
+        if (bn == 0)
+        {
+            std::fill(rp, rp + an, Limb(0));
+        }
+        else if (bn < std::max<std::size_t>(D_AKR_BIGDECIMALINT_MUL_KARATSUBA, 4))
+        {
+            dec_mul_basecase(rp, ap, an, bp, bn);
+        }
+        else if (bn <= (an + 1) / 2)
+        {
+            auto tmp = Nat(bn * 2);
+
+            std::fill(rp, rp + an + bn, Limb(0));
+
+            for (auto i = 0zu; i < an; i += bn)
+            {
+                const auto size = std::min(bn, an - i);
+
+                dec_mul(tmp.data(), ap + i, size, bp, bn);
+
+                dec_add(rp + i, rp + i, an + bn - i, tmp.data(), size + bn);
+            }
+        }
+        else
+        {
+            dec_mul_karatsuba(rp, ap, an, bp, bn);
+        }
+    }
+
+    // the binary magnitude of decimal limbs, hi * DecimalBase^(2^level) + lo from the largest level that splits them,
+    // with the powers of radix computed up to it.
+    inline auto dec_to_nat(const Limb* dp, std::size_t n, const Radix& radix) -> Nat
+    {
+        if (n <= std::max(thresholds().radixDivide, 1zu))
+        {
+            auto ret = Nat();
+
+            for (auto i = n; i > 0; i--)
+            {
+                if (const auto carry = mul_1(ret.data(), ret.data(), ret.size(), DecimalBase); carry != 0)
+                {
+                    ret.push_back(carry);
+                }
+
+                nat_add(ret, dp + i - 1, 1);
+            }
+
+            return ret;
+        }
+
+        auto level = 0zu;
+
+        for (; (2zu << level) < n;)
+        {
+            level++;
+        }
+
+        const auto half = 1zu << level;
+
+        auto hi = Nat();
+        auto lo = Nat();
+
+        fork_join(n, [&]
+                  {
+                      hi = dec_to_nat(dp + half, n - half, radix);
+                  },
+                  [&]
+                  {
+                      lo = dec_to_nat(dp, half, radix);
+                  });
+
+        auto ret = nat_mul(hi.data(), hi.size(), radix.powers[level].data(), radix.powers[level].size());
+
+        nat_add(ret, lo.data(), lo.size());
+
+        return ret;
+    }
+
+    // writes exactly 2^level decimal limbs of x < DecimalBase^(2^level) from dp on, as radix_write does digits.
+    inline void nat_to_dec(Limb* dp, Nat x, std::size_t level, const Radix& radix)
+    {
+        if (level == 0 || x.size() < std::max(thresholds().radixDivide, 1zu))
+        {
+            for (auto i = 0zu; i < (1zu << level); i++)
+            {
+                dp[i] = x.empty() ? Limb(0) : divrem_1(x.data(), x.data(), x.size(), DecimalBase);
+
+                nat_trim(x);
+            }
+
+            return;
+        }
+
+        auto hi = Nat();
+        auto lo = Nat();
+
+        div_qr(hi, lo, x, radix.powers[level - 1]);
+
+        x = Nat();
+
+        const auto half = 1zu << (level - 1);
+
+        fork_join(hi.size(), [&]
+                  {
+                      nat_to_dec(dp + half, std::move(hi), level - 1, radix);
+                  },
+                  [&]
+                  {
+                      nat_to_dec(dp, std::move(lo), level - 1, radix);
+                  });
+    }
+}
+
+namespace akr
+{
+    // an integer kept as a sign and limbs of 19 decimal digits, for work that mostly reads and prints decimal text:
+    // both take linear time, where BigInt has to convert through multiplications and divisions. Addition, subtraction
+    // and multiplication work on the decimal limbs, division and remainder go through BigInt.
+    struct BigDecimalInt final
+    {
+        private:
+        detail::Nat limbs;
+
+        bool        isNegative = false;
+
+        public:
+        BigDecimalInt() = default;
+
+        template<std::integral T>
+        BigDecimalInt(T number)
+        {
+            using U = std::make_unsigned_t<T>;
+
+            auto magnitude = static_cast<U>(number);
+
+            if constexpr (std::is_signed_v<T>)
+            {
+                isNegative = number < 0;
+
+                magnitude  = isNegative ? static_cast<U>(U(0) - magnitude) : magnitude;
+            }
+
+            for (; magnitude != 0; magnitude = static_cast<U>(magnitude / detail::DecimalBase))
+            {
+                limbs.push_back(static_cast<detail::Limb>(magnitude % detail::DecimalBase));
+            }
+        }
+
+        // the same value in decimal limbs, DecimalBase^(2^level) at a time from the top down.
+        explicit BigDecimalInt(const BigInt& value):
+            isNegative(value < 0)
+        {
+            auto magnitude = detail::BigIntAccess::magnitude(value);
+
+            if (magnitude.empty())
+            {
+                return;
+            }
+
+            auto radix = detail::Radix(10);
+
+            auto level = 0zu;
+
+            for (; detail::nat_cmp(radix.power(level), magnitude) <= 0;)
+            {
+                level++;
+            }
+
+            limbs.resize(1zu << level);
+
+            detail::nat_to_dec(limbs.data(), std::move(magnitude), level, radix);
+
+            detail::nat_trim(limbs);
+        }
+
+        template<std::size_t N>
+        BigDecimalInt(const char(&numChars)[N]):
+            BigDecimalInt(std::string_view(numChars, N - 1))
+        {
+        }
+
+        template<class T>
+        requires(std::same_as<typename T::value_type, char>)
+        BigDecimalInt(const T& numStrContainer):
+            BigDecimalInt(std::string_view(numStrContainer.begin(), numStrContainer.end()))
+        {
+        }
+
+        private:
+        // an optional sign and decimal digits, read 19 at a time from the end.
+        BigDecimalInt(std::string_view numStrView)
+        {
+            if (numStrView.starts_with('+') || numStrView.starts_with('-'))
+            {
+                isNegative = numStrView.front() == '-';
+
+                numStrView.remove_prefix(1);
+            }
+
+            if (numStrView.empty() || numStrView.find_first_not_of("0123456789") != std::string_view::npos)
+            {
+                throw std::invalid_argument("character is invalid.");
+            }
+
+            limbs.resize((numStrView.size() + detail::DecimalDigits - 1) / detail::DecimalDigits);
+
+            for (auto i = 0zu; i < limbs.size(); i++)
+            {
+                const auto end   = numStrView.size() - i * detail::DecimalDigits;
+                const auto begin = end > detail::DecimalDigits ? end - detail::DecimalDigits : 0;
+
+                auto limb = detail::Limb(0);
+
+                for (auto j = begin; j < end; j++)
+                {
+                    limb = limb * 10 + static_cast<detail::Limb>(numStrView[j] - '0');
+                }
+
+                limbs[i] = limb;
+            }
+
+            detail::nat_trim(limbs);
+
+            isNegative = isNegative && !limbs.empty();
+        }
+
+        public:
+        auto operator+= (const BigDecimalInt& rhs) -> BigDecimalInt&
+        {
+            auto&& lhs = *this;
+
+            if (&lhs == &rhs)
+            {
+                return lhs += BigDecimalInt(rhs);
+            }
+
+            if (lhs.isNegative == rhs.isNegative)
+            {
+                addMagnitude(lhs.limbs, rhs.limbs);
+            }
+            else if (cmpMagnitude(lhs.limbs, rhs.limbs) >= 0)
+            {
+                subMagnitude(lhs.limbs, rhs.limbs);
+            }
+            else
+            {
+                auto magnitude = rhs.limbs;
+
+                subMagnitude(magnitude, lhs.limbs);
+
+                lhs.limbs = std::move(magnitude);
+
+                lhs.isNegative = rhs.isNegative;
+            }
+
+            lhs.isNegative = lhs.isNegative && !lhs.limbs.empty();
+
+            return lhs;
+        }
+        auto operator-= (const BigDecimalInt& rhs) -> BigDecimalInt&
+        {
+            return *this += -rhs;
+        }
+        auto operator*= (const BigDecimalInt& rhs) -> BigDecimalInt&
+        {
+            auto&& lhs = *this;
+
+            if (lhs.limbs.empty() || rhs.limbs.empty())
+            {
+                return lhs = BigDecimalInt();
+            }
+
+            auto product = detail::Nat(lhs.limbs.size() + rhs.limbs.size());
+
+            detail::dec_mul(product.data(), lhs.limbs.data(), lhs.limbs.size(), rhs.limbs.data(), rhs.limbs.size());
+
+            detail::nat_trim(product);
+
+            lhs.limbs = std::move(product);
+
+            lhs.isNegative = lhs.isNegative != rhs.isNegative;
+
+            return lhs;
+        }
+        auto operator/= (const BigDecimalInt& rhs) -> BigDecimalInt&
+        {
+            return *this = BigDecimalInt(ToBigInt() / rhs.ToBigInt());
+        }
+        auto operator%= (const BigDecimalInt& rhs) -> BigDecimalInt&
+        {
+            return *this = BigDecimalInt(ToBigInt() % rhs.ToBigInt());
+        }
+
+        auto operator++ (   ) -> BigDecimalInt&
+        {
+            auto&& rhs = *this;
+
+            return rhs += 1;
+        }
+        auto operator++ (int) -> BigDecimalInt
+        {
+            auto&& lhs = *this;
+
+            BigDecimalInt tmp(lhs);
+
+            ++lhs;
+
+            return tmp;
+        }
+
+        auto operator-- (   ) -> BigDecimalInt&
+        {
+            auto&& rhs = *this;
+
+            return rhs -= 1;
+        }
+        auto operator-- (int) -> BigDecimalInt
+        {
+            auto&& lhs = *this;
+
+            BigDecimalInt tmp(lhs);
+
+            --lhs;
+
+            return tmp;
+        }
+
+        public:
+        friend auto operator+ (const BigDecimalInt& rhs) -> const BigDecimalInt&
+        {
+            return rhs;
+        }
+        friend auto operator- (const BigDecimalInt& rhs) -> BigDecimalInt
+        {
+            auto ret = rhs;
+
+            ret.isNegative = !ret.isNegative && !ret.limbs.empty();
+
+            return ret;
+        }
+
+        friend auto operator+ (const BigDecimalInt& lhs, const BigDecimalInt& rhs) -> BigDecimalInt
+        {
+            return BigDecimalInt(lhs) += rhs;
+        }
+        friend auto operator- (const BigDecimalInt& lhs, const BigDecimalInt& rhs) -> BigDecimalInt
+        {
+            return BigDecimalInt(lhs) -= rhs;
+        }
+        friend auto operator* (const BigDecimalInt& lhs, const BigDecimalInt& rhs) -> BigDecimalInt
+        {
+            return BigDecimalInt(lhs) *= rhs;
+        }
+        friend auto operator/ (const BigDecimalInt& lhs, const BigDecimalInt& rhs) -> BigDecimalInt
+        {
+            return BigDecimalInt(lhs) /= rhs;
+        }
+        friend auto operator% (const BigDecimalInt& lhs, const BigDecimalInt& rhs) -> BigDecimalInt
+        {
+            return BigDecimalInt(lhs) %= rhs;
+        }
+
+        friend auto operator== (const BigDecimalInt& lhs, const BigDecimalInt& rhs) noexcept -> bool
+        {
+            return lhs.isNegative == rhs.isNegative && lhs.limbs == rhs.limbs;
+        }
+        friend auto operator<=>(const BigDecimalInt& lhs, const BigDecimalInt& rhs) noexcept -> std::strong_ordering
+        {
+            if (lhs.isNegative != rhs.isNegative)
+            {
+                return lhs.isNegative ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+
+            const auto order = cmpMagnitude(lhs.limbs, rhs.limbs);
+
+            return (lhs.isNegative ? -order : order) <=> 0;
+        }
+
+        // reads one whitespace delimited number of optional sign and decimal digits.
+        friend auto operator>>(std::istream& lhs,       BigDecimalInt& rhs) -> std::istream&
+        {
+            const auto sentry = std::istream::sentry(lhs);
+
+            if (!sentry)
+            {
+                return lhs;
+            }
+
+            auto text = std::string();
+
+            for (auto c = lhs.peek(); c != std::istream::traits_type::eof() && !std::isspace(static_cast<char>(c), lhs.getloc()); c = lhs.peek())
+            {
+                text.push_back(static_cast<char>(lhs.get()));
+            }
+
+            if (text.empty())
+            {
+                lhs.setstate(std::ios_base::failbit);
+
+                return lhs;
+            }
+
+            rhs = BigDecimalInt(std::string_view(text));
+
+            return lhs;
+        }
+
+        friend auto operator<<(std::ostream& lhs, const BigDecimalInt& rhs) -> std::ostream&
+        {
+            return lhs << rhs.ToStdString();
+        }
+
+        public:
+        void swap(BigDecimalInt& rhs) noexcept
+        {
+            limbs.swap(rhs.limbs);
+
+            std::swap(isNegative, rhs.isNegative);
+        }
+
+        // the decimal digits, written a limb at a time.
+        auto ToStdString() const -> std::string
+        {
+            if (limbs.empty())
+            {
+                return "0";
+            }
+
+            auto top = std::to_string(limbs.back());
+
+            auto ret = std::string(isNegative + top.size() + (limbs.size() - 1) * detail::DecimalDigits, '-');
+
+            std::copy(top.begin(), top.end(), ret.begin() + isNegative);
+
+            auto end = ret.data() + ret.size();
+
+            for (auto i = 0zu; i + 1 < limbs.size(); i++)
+            {
+                auto limb = limbs[i];
+
+                for (auto j = 0zu; j < detail::DecimalDigits; j++)
+                {
+                    *--end = static_cast<char>('0' + limb % 10);
+
+                    limb /= 10;
+                }
+            }
+
+            return ret;
+        }
+
+        // the same value as a BigInt, by halves that meet in a multiplication by a power of 10^19.
+        auto ToBigInt() const -> BigInt
+        {
+            if (limbs.empty())
+            {
+                return BigInt();
+            }
+
+            auto radix = detail::Radix(10);
+
+            auto level = 0zu;
+
+            for (; (2zu << level) < limbs.size();)
+            {
+                level++;
+            }
+
+            radix.power(level);
+
+            return detail::BigIntAccess::fromMagnitude(detail::dec_to_nat(limbs.data(), limbs.size(), radix), isNegative);
+        }
+
+        private:
+        static auto cmpMagnitude(const detail::Nat& lhs, const detail::Nat& rhs) noexcept -> int
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return lhs.size() < rhs.size() ? -1 : 1;
+            }
+
+            for (auto i = lhs.size(); i > 0; i--)
+            {
+                if (lhs[i - 1] != rhs[i - 1])
+                {
+                    return lhs[i - 1] < rhs[i - 1] ? -1 : 1;
+                }
+            }
+
+            return 0;
+        }
+
+        static void addMagnitude(detail::Nat& lhs, const detail::Nat& rhs)
+        {
+            if (lhs.size() < rhs.size())
+            {
+                lhs.resize(rhs.size());
+            }
+
+            if (const auto carry = detail::dec_add(lhs.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size()); carry != 0)
+            {
+                lhs.push_back(carry);
+            }
+        }
+
+        // requires lhs >= rhs.
+        static void subMagnitude(detail::Nat& lhs, const detail::Nat& rhs)
+        {
+            detail::dec_sub(lhs.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+
+            detail::nat_trim(lhs);
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+namespace akr::test
+{
+    AKR_TEST(BigDecimalInt,
+    {
+        auto re = std::mt19937_64(2022);
+
+        for (auto i = 0; i < 300; i++)
+        {
+            const auto a = random_bits(re, re() % (i < 280 ? 4000 : 40000)) * (i % 3 == 0 ? -1 : 1);
+            const auto b = random_bits(re, re() % (i < 280 ? 4000 : 40000)) * (i % 4 == 0 ? -1 : 1);
+
+            const auto x = BigDecimalInt(a.ToStdString());
+            const auto y = BigDecimalInt(b);
+
+            assert(x.ToStdString() == a.ToStdString() && x.ToBigInt() == a && BigDecimalInt(x.ToBigInt()) == x);
+            assert((x + y).ToBigInt() == a + b && (x - y).ToBigInt() == a - b && (x * y).ToBigInt() == a * b);
+            assert((x < y) == (a < b) && (x == y) == (a == b) && (-x).ToBigInt() == -a);
+
+            if (b != 0)
+            {
+                assert((x / y).ToBigInt() == a / b && (x % y).ToBigInt() == a % b);
+            }
+        }
+
+        auto sum = BigDecimalInt();
+
+        for (auto i = 0; i < 100; i++)
+        {
+            sum += "99999999999999999999";
+            sum -= BigDecimalInt(i);
+        }
+
+        assert(sum == "9999999999999999994950" && sum.ToStdString() == "9999999999999999994950");
+
+        assert(BigDecimalInt(std::numeric_limits<std::int64_t>::min()).ToBigInt() == std::numeric_limits<std::int64_t>::min());
+        assert(BigDecimalInt(std::numeric_limits<std::uint64_t>::max()).ToStdString() == "18446744073709551615");
+        assert(BigDecimalInt("-000") == 0 && BigDecimalInt("-0").ToStdString() == "0" && BigDecimalInt("+0010000000000000000000").ToStdString() == "10000000000000000000");
+
+        const auto nines = BigDecimalInt(std::string(2000, '9'));
+
+        assert((nines * nines).ToBigInt() == nines.ToBigInt() * nines.ToBigInt());
+
+        auto self = BigDecimalInt("-12345678901234567890123");
+
+        self *= self;
+        self -= self;
+
+        assert(self == 0 && -self == 0);
+
+        auto counter = BigDecimalInt("9999999999999999999");
+
+        assert(++counter == "10000000000000000000" && counter-- == "10000000000000000000" && counter == "9999999999999999999");
+        assert(BigDecimalInt(0)-- == 0 && --BigDecimalInt(0) == -1 && ++BigDecimalInt(-1) == 0 && BigDecimalInt(-1)++ == -1);
+
+        auto stream = std::istringstream("  -00123456789012345678901234567890 42\n");
+
+        auto parsed = BigDecimalInt();
+
+        assert(stream >> parsed && parsed == BigDecimalInt(BigInt("-123456789012345678901234567890")));
+        assert(stream >> parsed && parsed == 42 && !(stream >> parsed) && parsed == 42);
+
+        auto isThrown = 0;
+
+        try
+        {
+            BigDecimalInt("12a");
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        try
+        {
+            BigDecimalInt("-");
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        try
+        {
+            BigDecimalInt(1) / 0;
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        try
+        {
+            auto bad = std::istringstream("0x1F");
+
+            bad >> parsed;
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        assert(isThrown == 4 && parsed == 42);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_BIGDECIMALINT_HH
@@ -4,18 +4,52 @@
 #include <boost/dynamic_bitset.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
 #include <charconv>
+#include <compare>
 #include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <initializer_list>
 #include <iosfwd>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <numeric>
 #include <optional>
+#include <ostream>
+#include <random>
+#include <ranges>
 #include <span>
 #include <stdexcept>
+#include <system_error>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(D_AKR_BIGINT_GENERIC_KERNELS)
+#define U_AKR_BIGINT_X86
+#include <cpuid.h>
+#endif
 
 #ifdef  _MSC_VER
 #if _MSC_VER <= 1932
@@ -29,1532 +63,9091 @@ consteval auto operator""zu(unsigned long long value) noexcept
 #endif
 #endif//_MSC_VER
 
-namespace akr
+namespace akr::detail
 {
-    struct BigInt final
-    {
-        private:
-        using BitSet = boost::dynamic_bitset<std::size_t>;
-
-        private:
-        struct Trim final
-        {
-            private:
-            std::size_t count0 = 0;
+    using Limb = std::size_t;
 
-            std::size_t count1 = 0;
+    inline constexpr auto LimbBits = static_cast<std::size_t>(std::numeric_limits<Limb>::digits);
 
-            public:
-            Trim() = default;
+    constexpr auto add_with_carry (Limb lhs, Limb rhs, Limb& carry) noexcept -> Limb
+    {
+        const auto sum = lhs + rhs;
 
-            public:
-            void Count(bool bit) noexcept
-            {
-                if (bit)
-                {
-                    count0 = 0;
+        const auto ret = sum + carry;
 
-                    count1++;
-                }
-                else
-                {
-                    count1 = 0;
+        carry = static_cast<Limb>(sum < lhs) + static_cast<Limb>(ret < sum);
 
-                    count0++;
-                }
-            }
+        return ret;
+    }
 
-            public:
-            void operator()(BigInt& bigInt) const
-            {
-                bigInt.binNumber.resize(bigInt.binNumber.size() - (!bigInt.isNegative ? count0 : count1));
-            }
-        };
+    constexpr auto sub_with_borrow(Limb lhs, Limb rhs, Limb& borrow) noexcept -> Limb
+    {
+        const auto dif = lhs - rhs;
 
-        private:
-        BitSet binNumber;
+        const auto ret = dif - borrow;
 
-        bool   isNegative = false;
+        borrow = static_cast<Limb>(lhs < rhs) + static_cast<Limb>(dif < borrow);
 
-        public:
-        BigInt() = default;
+        return ret;
+    }
 
-        template<std::integral T>
-        BigInt(T number):
-            BigInt(std::to_string(number))
+    // returns the low limb of lhs * rhs, the high limb is stored into hi.
+    constexpr auto mul_wide(Limb lhs, Limb rhs, Limb& hi) noexcept -> Limb
+    {
+        if constexpr (LimbBits == 32)
         {
-        }
+            const auto ret = static_cast<std::uint64_t>(lhs) * rhs;
 
-        template<std::size_t N>
-        BigInt(const char(&numChars)[N], std::optional<int> base = std::nullopt):
-            BigInt(std::string_view(numChars, N - 1), base)
-        {
-        }
+            hi = static_cast<Limb>(ret >> 32);
 
-        template<class T>
-        requires(std::same_as<typename T::value_type, char>)
-        BigInt(const T& numStrContainer, std::optional<int> base = std::nullopt):
-            BigInt(std::string_view(numStrContainer.begin(), numStrContainer.end()), base)
-        {
+            return static_cast<Limb>(ret);
         }
-
-        private:
-        BigInt(std::string_view numStrView, std::optional<int> base = std::nullopt)
+        else
         {
-            static const auto charToDigit = [](char c_)
-            {
-                if ('0' <= c_ && c_ <= '9')
-                {
-                    return c_ - '0';
-                }
-                else if ('A' <= c_ && c_ <= 'Z')
-                {
-                    return c_ - 'A' + 10;
-                }
-                else if ('a' <= c_ && c_ <= 'z')
-                {
-                    return c_ - 'a' + 10;
-                }
-                else
-                {
-                    throw std::invalid_argument("character is invalid.");
-                }
-            };
+#ifdef  __SIZEOF_INT128__
+            const auto ret = static_cast<unsigned __int128>(lhs) * rhs;
 
-            static const auto checkNumStr = [](auto&& numStrView_, auto base_)
-            {
-                return !std::ranges::all_of(numStrView_, [&base_](char c_)
-                                            {
-                                                const auto digit_ = charToDigit(c_);
+            hi = static_cast<Limb>(ret >> 64);
 
-                                                return 0 <= digit_ && digit_ < base_;
-                                            });
-            };
+            return static_cast<Limb>(ret);
+#else
+            constexpr auto HalfBits = LimbBits / 2;
 
-            static const auto mod2 = [](auto&& strSpan_, auto base_) -> bool
-            {
-                return std::accumulate(strSpan_.rbegin(), strSpan_.rbegin() + (base_ % 2 == 0 ? 1 : strSpan_.size()),
-                                       0, [](auto a_, char c_)
-                                       {
-                                           return a_ + charToDigit(c_) % 2;
-                                       }) % 2;
-            };
+            constexpr auto HalfMask = (Limb(1) << HalfBits) - 1;
 
-            static const auto div2 = [](auto&& strSpan_, auto base_)
-            {
-                const bool isOddBase_ = base_ % 2;
+            const auto l0 = lhs & HalfMask, l1 = lhs >> HalfBits;
+            const auto r0 = rhs & HalfMask, r1 = rhs >> HalfBits;
 
-                const auto carryBase_ = base_ / 2;
+            const auto p00 = l0 * r0;
+            const auto p01 = l0 * r1;
+            const auto p10 = l1 * r0;
+            const auto p11 = l1 * r1;
 
-                auto carry_ = 0;
+            const auto mid = (p00 >> HalfBits) + (p01 & HalfMask) + (p10 & HalfMask);
 
-                auto tmpSpan_ = std::decay_t<decltype(strSpan_)> {};
+            hi = p11 + (p01 >> HalfBits) + (p10 >> HalfBits) + (mid >> HalfBits);
 
-                auto tmpSize_ = 0zu;
+            return (mid << HalfBits) | (p00 & HalfMask);
+#endif//__SIZEOF_INT128__
+        }
+    }
 
-                for (auto i_ = 0zu; auto&& e_ : strSpan_)
-                {
-                    const bool isCarry0_ = carry_;
+    // divides (hi:lo) by div, requires hi < div.
+    constexpr auto div_wide(Limb hi, Limb lo, Limb div, Limb& rem) noexcept -> Limb
+    {
+        if constexpr (LimbBits == 32)
+        {
+            const auto num = (static_cast<std::uint64_t>(hi) << 32) | lo;
 
-                    const auto curDigit_ = charToDigit(e_);
+            rem = static_cast<Limb>(num % div);
 
-                    const bool oddDigit_ = curDigit_ % 2;
+            return static_cast<Limb>(num / div);
+        }
+        else
+        {
+#ifdef  __SIZEOF_INT128__
+            const auto num = (static_cast<unsigned __int128>(hi) << 64) | lo;
 
-                    const auto newDigit_ = curDigit_ / 2 + carry_ + (isCarry0_ & isOddBase_ & oddDigit_);
+            rem = static_cast<Limb>(num % div);
 
-                    carry_ = carryBase_ * ((isCarry0_ & isOddBase_) ^ oddDigit_);
+            return static_cast<Limb>(num / div);
+#else
+            constexpr auto HalfBits = LimbBits / 2;
 
-                    if (const auto newChar_ = digitToChar(newDigit_); !tmpSpan_.empty())
-                    {
-                        tmpSpan_[tmpSize_++] = newChar_;
-                    }
-                    else if (newDigit_ != 0)
-                    {
-                        tmpSpan_ = strSpan_.subspan(i_);
+            constexpr auto HalfBase = Limb(1) << HalfBits;
 
-                        tmpSpan_[tmpSize_++] = newChar_;
-                    }
-                    else
-                    {
-                        i_++;
-                    }
-                }
+            constexpr auto HalfMask = HalfBase - 1;
 
-                return tmpSpan_;
-            };
+            const auto shift = static_cast<std::size_t>(std::countl_zero(div));
+
+            div <<= shift;
+
+            const auto vn1 = div >> HalfBits;
+            const auto vn0 = div &  HalfMask;
+
+            const auto un32 = shift == 0 ? hi : (hi << shift) | (lo >> (LimbBits - shift));
+            const auto un10 = lo << shift;
+
+            const auto un1 = un10 >> HalfBits;
+            const auto un0 = un10 &  HalfMask;
+
+            auto q1   = un32 / vn1;
+            auto rhat = un32 - q1 * vn1;
 
-            if (base.has_value())
+            for (; q1 >= HalfBase || q1 * vn0 > ((rhat << HalfBits) | un1);)
             {
-                if (!(2 <= base.value() && base.value() <= 36))
-                {
-                    throw std::invalid_argument("base is invalid.");
-                }
+                q1--;
+                rhat += vn1;
 
-                for (;;)
+                if (rhat >= HalfBase)
                 {
-                    switch (numStrView.front())
-                    {
-                        case '0':
-                            if (numStrView.size() == 1)
-                            {
-                                isNegative = false;
-                                return;
-                            }
-                            break;
-                        case '1':
-                            if (numStrView.size() == 1 && isNegative)
-                            {
-                                return;
-                            }
-                            break;
-                        case '+':
-                            numStrView.remove_prefix(1);
-                            continue;
-                        case '-':
-                            isNegative = true;
-                            numStrView.remove_prefix(1);
-                            continue;
-                        default:
-                            break;
-                    }
                     break;
                 }
             }
-            else
+
+            const auto un21 = (un32 << HalfBits) + un1 - q1 * div;
+
+            auto q0 = un21 / vn1;
+            rhat    = un21 - q0 * vn1;
+
+            for (; q0 >= HalfBase || q0 * vn0 > ((rhat << HalfBits) | un0);)
             {
-                for (;;)
-                {
-                    switch (numStrView.front())
-                    {
-                        case '0':
-                            if (numStrView.size() == 1)
-                            {
-                                isNegative = false;
-                                return;
-                            }
-                            else
-                            {
-                                base = 010;
-                                numStrView.remove_prefix(1);
-                                continue;
-                            }
-                        case '1':
-                            if (numStrView.size() == 1 && isNegative)
-                            {
-                                return;
-                            }
-                            break;
-                        case '+':
-                            numStrView.remove_prefix(1);
-                            continue;
-                        case '-':
-                            isNegative = true;
-                            numStrView.remove_prefix(1);
-                            continue;
-                        case 'B':
-                            [[fallthrough]];
-                        case 'b':
-                            if (base.has_value())
-                            {
-                                base = 0B10;
-                                numStrView.remove_prefix(1);
-                            }
-                            break;
-                        case 'X':
-                            [[fallthrough]];
-                        case 'x':
-                            if (base.has_value())
-                            {
-                                base = 0X10;
-                                numStrView.remove_prefix(1);
-                            }
-                            break;
-                        default:
-                            break;
-                    }
-                    break;
-                }
+                q0--;
+                rhat += vn1;
 
-                if (!base.has_value())
+                if (rhat >= HalfBase)
                 {
-                    base = 10;
+                    break;
                 }
             }
 
-            const auto newBase = base.value();
+            rem = ((un21 << HalfBits) + un0 - q0 * div) >> shift;
 
-            if (checkNumStr(numStrView, newBase))
-            {
-                throw std::invalid_argument("character is invalid.");
-            }
+            return (q1 << HalfBits) | q0;
+#endif//__SIZEOF_INT128__
+        }
+    }
+
+    constexpr auto normalized_size(const Limb* ap, std::size_t n) noexcept -> std::size_t
+    {
+        for (; n > 0 && ap[n - 1] == 0;)
+        {
+            n--;
+        }
 
-            auto dupStr = std::string(numStrView);
+        return n;
+    }
 
-            bool isFlip = true;
+    constexpr auto cmp(const Limb* ap, const Limb* bp, std::size_t n) noexcept -> int
+    {
+        for (; n > 0;)
+        {
+            n--;
 
-            for (auto dupSpan = std::span(dupStr.begin(), dupStr.end()); !dupSpan.empty();)
+            if (ap[n] != bp[n])
             {
-                const auto bit = mod2(dupSpan, newBase);
+                return ap[n] < bp[n] ? -1 : 1;
+            }
+        }
 
-                if (!isNegative)
-                {
-                    binNumber.push_back(bit);
-                }
-                else if (isFlip)
-                {
-                    binNumber.push_back(bit);
+        return 0;
+    }
 
-                    if (bit)
-                    {
-                        isFlip = false;
-                    }
-                }
-                else
-                {
-                    binNumber.push_back(!bit);
-                }
+    // compares two normalized magnitudes of arbitrary sizes.
+    constexpr auto cmp(const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept -> int
+    {
+        if (an != bn)
+        {
+            return an < bn ? -1 : 1;
+        }
 
-                dupSpan = div2(dupSpan, newBase);
-            }
+        return cmp(ap, bp, an);
+    }
+
+    // the portable limb kernels, also used in constant evaluation.
+    namespace generic
+    {
+        constexpr auto add_n(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb
+        {
+            auto carry = Limb(0);
 
-            if (isNegative && binNumber[binNumber.size() - 1])
+            for (auto i = 0zu; i < n; i++)
             {
-                binNumber.pop_back();
+                rp[i] = add_with_carry(ap[i], bp[i], carry);
             }
+
+            return carry;
         }
 
-        public:
-        auto operator+= (const BigInt& rhs) -> BigInt&
+        constexpr auto sub_n(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb
         {
-            auto&& lhs = *this;
+            auto borrow = Limb(0);
 
-            if (rhs.isZero())
+            for (auto i = 0zu; i < n; i++)
             {
-                return lhs;
+                rp[i] = sub_with_borrow(ap[i], bp[i], borrow);
             }
 
-            if (lhs.isZero())
-            {
-                return lhs = rhs;
-            }
+            return borrow;
+        }
 
-            auto needCarry = false;
+        constexpr auto mul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+        {
+            auto carry = Limb(0);
 
-            if (lhs.isNegative == rhs.isNegative)
+            for (auto i = 0zu; i < n; i++)
             {
-                forEachBit(rhs, [&needCarry       ](bool lhs_, bool rhs_) noexcept
-                           {
-                               const auto newBit_ = lhs_ ^ rhs_ ^ needCarry;
-
-                               if (lhs_ == rhs_)
-                               {
-                                   needCarry = lhs_;
-                               }
+                auto hi = Limb(0);
 
-                               return newBit_;
-                           });
+                const auto lo = mul_wide(ap[i], b, hi);
 
-                const bool newBit = lhs.isNegative ^ rhs.isNegative ^ needCarry;
+                rp[i] = lo + carry;
 
-                if (newBit ^ lhs.isNegative)
-                {
-                    lhs.binNumber.push_back(newBit);
-                }
+                carry = hi + (rp[i] < lo);
             }
-            else
-            {
-                Trim trim;
 
-                forEachBit(rhs, [&needCarry, &trim](bool lhs_, bool rhs_) noexcept
-                           {
-                               const auto newBit_ = lhs_ ^ rhs_ ^ needCarry;
+            return carry;
+        }
 
-                               if (lhs_ == rhs_)
-                               {
-                                   needCarry = lhs_;
-                               }
+        constexpr auto addmul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+        {
+            auto carry = Limb(0);
 
-                               trim.Count(newBit_);
+            for (auto i = 0zu; i < n; i++)
+            {
+                auto hi = Limb(0);
 
-                               return newBit_;
-                           });
+                auto lo = mul_wide(ap[i], b, hi);
 
-                lhs.isNegative = lhs.isNegative ^ rhs.isNegative ^ needCarry;
+                lo += carry;
 
-                trim(lhs);
+                hi += lo < carry;
+
+                rp[i] += lo;
+
+                carry = hi + (rp[i] < lo);
             }
 
-            return lhs;
+            return carry;
         }
-        auto operator-= (const BigInt& rhs) -> BigInt&
+
+        constexpr auto submul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
         {
-            auto&& lhs = *this;
+            auto borrow = Limb(0);
 
-            if (rhs.isZero())
+            for (auto i = 0zu; i < n; i++)
             {
-                return lhs;
-            }
+                auto hi = Limb(0);
 
-            if (lhs.isZero())
-            {
-                (-rhs).swap(lhs);
+                auto lo = mul_wide(ap[i], b, hi);
 
-                return lhs;
-            }
+                lo += borrow;
 
-            if (lhs == rhs)
-            {
-                BigInt("0").swap(lhs);
+                hi += lo < borrow;
 
-                return lhs;
-            }
+                const auto r = rp[i];
 
-            return lhs += -rhs;
-        }
-        auto operator*= (const BigInt& rhs) -> BigInt&
-        {
-            auto&& lhs = *this;
+                rp[i] = r - lo;
 
-            if (lhs.isZero())
-            {
-                return lhs;
+                borrow = hi + (r < lo);
             }
 
-            if (rhs.isZero())
-            {
-                BigInt("0").swap(lhs);
+            return borrow;
+        }
 
-                return lhs;
-            }
+        // shifts left by 0 < shift < LimbBits, returns the bits shifted out.
+        constexpr auto lshift(Limb* rp, const Limb* ap, std::size_t n, std::size_t shift) noexcept -> Limb
+        {
+            auto out = Limb(0);
 
-            static const auto mul = [](auto&& lhs_, auto&& rhs_, auto&& ret_)
+            for (auto i = n; i > 0; i--)
             {
-                BigInt("0").swap(ret_);
+                const auto a = ap[i - 1];
 
-                const auto posLhsLength_ = lhs_.binNumber.size();
-
-                for (auto i_ = 0zu; i_ < posLhsLength_; i_++)
+                if (i == n)
                 {
-                    if (lhs_.binNumber[i_])
-                    {
-                        ret_ += rhs_;
-                    }
-
-                    rhs_ <<= 1;
+                    out = a >> (LimbBits - shift);
                 }
-            };
 
-            const bool isLhsNegative = lhs.isNegative ^ rhs.isNegative;
+                rp[i - 1] = (a << shift) | (i > 1 ? ap[i - 2] >> (LimbBits - shift) : 0);
+            }
 
-            auto posLhs = lhs.isNegative ? -lhs : lhs;
+            return out;
+        }
 
-            auto posRhs = rhs.isNegative ? -rhs : rhs;
+        // shifts right by 0 < shift < LimbBits, returns the bits shifted out in the high end of a limb.
+        constexpr auto rshift(Limb* rp, const Limb* ap, std::size_t n, std::size_t shift) noexcept -> Limb
+        {
+            const auto out = n > 0 ? ap[0] << (LimbBits - shift) : 0;
 
-            if (posLhs.binNumber.size() >= posRhs.binNumber.size())
-            {
-                mul(posRhs, posLhs, lhs);
-            }
-            else
+            for (auto i = 0zu; i < n; i++)
             {
-                mul(posLhs, posRhs, lhs);
+                rp[i] = (ap[i] >> shift) | (i + 1 < n ? ap[i + 1] << (LimbBits - shift) : 0);
             }
 
-            if (isLhsNegative)
-            {
-                lhs.unaryMinus();
-            }
-
-            return lhs;
+            return out;
         }
-        auto operator/= (const BigInt& rhs) -> BigInt&
+    }
+
+#ifdef  U_AKR_BIGINT_X86
+    // kernels for x86-64 CPUs with BMI2 and ADX. They are written in assembly so that they do not depend on the
+    // flags the includer compiles with: MULX leaves the flags alone, so the carries of the products (ADCX) and
+    // of the sums (ADOX) run in two chains, and the loops step with LEA and JRCXZ, which keep both. The shifts
+    // gain nothing from these instructions and stay generic.
+    namespace x86
+    {
+        inline auto add_n(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb
         {
-            if (rhs.isZero())
+            if (n == 0)
             {
-                throw std::invalid_argument("right operand is zero.");
+                return 0;
             }
 
-            auto&& lhs = *this;
+            auto word  = Limb(0);
+            auto index = -static_cast<std::ptrdiff_t>(n);
+
+            asm volatile("xor  %k[word], %k[word]\n\t"
+                         "1:\n\t"
+                         "mov  (%[ap],%[index],8), %[word]\n\t"
+                         "adc  (%[bp],%[index],8), %[word]\n\t"
+                         "mov  %[word], (%[rp],%[index],8)\n\t"
+                         "lea  1(%[index]), %[index]\n\t"
+                         "jrcxz 2f\n\t"
+                         "jmp  1b\n\t"
+                         "2:\n\t"
+                         "mov  $0, %k[word]\n\t"
+                         "adc  %k[word], %k[word]\n\t"
+                         : [word] "=&r"(word), [index] "+c"(index)
+                         : [rp] "r"(rp + n), [ap] "r"(ap + n), [bp] "r"(bp + n)
+                         : "cc", "memory");
+
+            return word;
+        }
 
-            if (lhs.isZero())
+        inline auto sub_n(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb
+        {
+            if (n == 0)
             {
-                return lhs;
+                return 0;
             }
 
-            if (lhs == rhs)
-            {
-                BigInt("1").swap(lhs);
+            auto word  = Limb(0);
+            auto index = -static_cast<std::ptrdiff_t>(n);
+
+            asm volatile("xor  %k[word], %k[word]\n\t"
+                         "1:\n\t"
+                         "mov  (%[ap],%[index],8), %[word]\n\t"
+                         "sbb  (%[bp],%[index],8), %[word]\n\t"
+                         "mov  %[word], (%[rp],%[index],8)\n\t"
+                         "lea  1(%[index]), %[index]\n\t"
+                         "jrcxz 2f\n\t"
+                         "jmp  1b\n\t"
+                         "2:\n\t"
+                         "mov  $0, %k[word]\n\t"
+                         "adc  %k[word], %k[word]\n\t"
+                         : [word] "=&r"(word), [index] "+c"(index)
+                         : [rp] "r"(rp + n), [ap] "r"(ap + n), [bp] "r"(bp + n)
+                         : "cc", "memory");
+
+            return word;
+        }
 
-                return lhs;
+        inline auto mul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+        {
+            if (n == 0)
+            {
+                return 0;
             }
 
-            static const auto div = [](auto&& lhs_, auto&& rhs_, auto&& ret_)
+            auto carry = Limb(0);
+            auto lo    = Limb(0);
+            auto hi    = Limb(0);
+            auto index = -static_cast<std::ptrdiff_t>(n);
+
+            asm volatile("xor  %k[lo], %k[lo]\n\t"
+                         "1:\n\t"
+                         "mulx (%[ap],%[index],8), %[lo], %[hi]\n\t"
+                         "adcx %[carry], %[lo]\n\t"
+                         "mov  %[lo], (%[rp],%[index],8)\n\t"
+                         "mov  %[hi], %[carry]\n\t"
+                         "lea  1(%[index]), %[index]\n\t"
+                         "jrcxz 2f\n\t"
+                         "jmp  1b\n\t"
+                         "2:\n\t"
+                         "mov  $0, %k[lo]\n\t"
+                         "adcx %[lo], %[carry]\n\t"
+                         : [carry] "+&r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi), [index] "+c"(index)
+                         : [rp] "r"(rp + n), [ap] "r"(ap + n), "d"(b)
+                         : "cc", "memory");
+
+            return carry;
+        }
+
+        inline auto addmul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+        {
+            if (n == 0)
             {
-                BigInt mul_("1");
+                return 0;
+            }
 
-                for (; lhs_ > rhs_;)
-                {
-                    rhs_ <<= 1;
-                    mul_ <<= 1;
-                }
+            auto carry = Limb(0);
+            auto lo    = Limb(0);
+            auto hi    = Limb(0);
+            auto index = -static_cast<std::ptrdiff_t>(n);
+
+            asm volatile("xor  %k[lo], %k[lo]\n\t"
+                         "1:\n\t"
+                         "mulx (%[ap],%[index],8), %[lo], %[hi]\n\t"
+                         "adcx %[carry], %[lo]\n\t"
+                         "adox (%[rp],%[index],8), %[lo]\n\t"
+                         "mov  %[lo], (%[rp],%[index],8)\n\t"
+                         "mov  %[hi], %[carry]\n\t"
+                         "lea  1(%[index]), %[index]\n\t"
+                         "jrcxz 2f\n\t"
+                         "jmp  1b\n\t"
+                         "2:\n\t"
+                         "mov  $0, %k[lo]\n\t"
+                         "adcx %[lo], %[carry]\n\t"
+                         "adox %[lo], %[carry]\n\t"
+                         : [carry] "+&r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi), [index] "+c"(index)
+                         : [rp] "r"(rp + n), [ap] "r"(ap + n), "d"(b)
+                         : "cc", "memory");
+
+            return carry;
+        }
 
-                for (; !mul_.isZero();)
-                {
-                    if (lhs_ >= rhs_)
-                    {
-                        lhs_ -= rhs_;
-                        ret_ += mul_;
-                    }
+        // rp - w is computed as rp + ~w + 1, so the sums can use the ADOX chain started with OF set.
+        inline auto submul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+        {
+            if (n == 0)
+            {
+                return 0;
+            }
 
-                    rhs_ >>= 1;
-                    mul_ >>= 1;
-                }
-            };
+            auto carry = Limb(0);
+            auto lo    = Limb(0);
+            auto hi    = Limb(0);
+            auto index = -static_cast<std::ptrdiff_t>(n);
+
+            asm volatile("movabs $0x7FFFFFFFFFFFFFFF, %[lo]\n\t"
+                         "add  $1, %[lo]\n\t"
+                         "1:\n\t"
+                         "mulx (%[ap],%[index],8), %[lo], %[hi]\n\t"
+                         "adcx %[carry], %[lo]\n\t"
+                         "not  %[lo]\n\t"
+                         "adox (%[rp],%[index],8), %[lo]\n\t"
+                         "mov  %[lo], (%[rp],%[index],8)\n\t"
+                         "mov  %[hi], %[carry]\n\t"
+                         "lea  1(%[index]), %[index]\n\t"
+                         "jrcxz 2f\n\t"
+                         "jmp  1b\n\t"
+                         "2:\n\t"
+                         "mov  $0, %k[lo]\n\t"
+                         "adcx %[lo], %[carry]\n\t"
+                         "seto %b[lo]\n\t"
+                         : [carry] "+&r"(carry), [lo] "=&r"(lo), [hi] "=&r"(hi), [index] "+c"(index)
+                         : [rp] "r"(rp + n), [ap] "r"(ap + n), "d"(b)
+                         : "cc", "memory");
+
+            return carry + 1 - lo;
+        }
 
-            const bool isLhsNegative = lhs.isNegative ^ rhs.isNegative;
+        inline auto is_supported() noexcept -> bool
+        {
+            auto eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
 
-            auto posLhs = lhs.isNegative ? -lhs : lhs;
+            return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0 && (ebx >> 8 & 1) != 0 && (ebx >> 19 & 1) != 0;
+        }
+    }
+#endif//U_AKR_BIGINT_X86
 
-            auto posRhs = rhs.isNegative ? -rhs : rhs;
+    // one set of the limb kernels that every other routine is built on.
+    struct Kernels final
+    {
+        std::string_view name;
 
-            BigInt("0").swap(lhs);
+        auto (*isSupported)() noexcept -> bool;
 
-            if (posLhs.binNumber.size() >= posRhs.binNumber.size())
-            {
-                div(posLhs, posRhs, lhs);
+        auto (*addN    )(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb;
+        auto (*subN    )(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb;
+        auto (*mul1    )(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb;
+        auto (*addmul1 )(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb;
+        auto (*submul1 )(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb;
+        auto (*lshift  )(Limb* rp, const Limb* ap, std::size_t n, std::size_t shift) noexcept -> Limb;
+        auto (*rshift  )(Limb* rp, const Limb* ap, std::size_t n, std::size_t shift) noexcept -> Limb;
+    };
 
-                if (isLhsNegative)
-                {
-                    lhs.unaryMinus();
-                }
-            }
+    // every set this build knows about, from the most portable to the fastest.
+    inline constexpr Kernels KernelSets[] =
+    {
+        {
+            "generic", [] noexcept { return true; },
+            generic::add_n, generic::sub_n, generic::mul_1, generic::addmul_1, generic::submul_1, generic::lshift, generic::rshift,
+        },
+#ifdef  U_AKR_BIGINT_X86
+        {
+            "bmi2-adx", x86::is_supported,
+            x86::add_n, x86::sub_n, x86::mul_1, x86::addmul_1, x86::submul_1, generic::lshift, generic::rshift,
+        },
+#endif//U_AKR_BIGINT_X86
+    };
 
-            return lhs;
-        }
-        auto operator%= (const BigInt& rhs) -> BigInt&
+    // the fastest set the CPU supports, or the one named by the AKR_BIGINT_KERNELS environment variable if the CPU
+    // supports that.
+    inline auto select_kernels() noexcept -> const Kernels*
+    {
+        auto ret = &KernelSets[0];
+
+        for (auto&& e : KernelSets)
         {
-            if (rhs.isZero())
+            if (e.isSupported())
             {
-                throw std::invalid_argument("right operand is zero.");
+                ret = &e;
             }
+        }
 
-            auto&& lhs = *this;
-
-            if (lhs.isZero())
+        if (const auto name = std::getenv("AKR_BIGINT_KERNELS"); name != nullptr)
+        {
+            for (auto&& e : KernelSets)
             {
-                return lhs;
+                if (e.name == name && e.isSupported())
+                {
+                    ret = &e;
+                }
             }
+        }
 
-            if (lhs == rhs)
-            {
-                BigInt("0").swap(lhs);
+        return ret;
+    }
 
-                return lhs;
-            }
+    inline auto kernels() noexcept -> const Kernels*&
+    {
+        static auto ret = select_kernels();
 
-            static const auto mod = [](auto&& lhs_, auto&& rhs_)
-            {
-                BigInt mul_("1");
+        return ret;
+    }
 
-                for (; lhs_ > rhs_;)
-                {
-                    rhs_ <<= 1;
-                    mul_ <<= 1;
-                }
+    constexpr auto add_n(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
+        {
+            return generic::add_n(rp, ap, bp, n);
+        }
 
-                for (; !mul_.isZero();)
-                {
-                    if (lhs_ >= rhs_)
-                    {
-                        lhs_ -= rhs_;
-                    }
+        return kernels()->addN(rp, ap, bp, n);
+    }
 
-                    rhs_ >>= 1;
-                    mul_ >>= 1;
-                }
-            };
+    constexpr auto sub_n(Limb* rp, const Limb* ap, const Limb* bp, std::size_t n) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
+        {
+            return generic::sub_n(rp, ap, bp, n);
+        }
 
-            const bool isLhsNegative = lhs.isNegative;
+        return kernels()->subN(rp, ap, bp, n);
+    }
 
-            if (isLhsNegative)
-            {
-                lhs.unaryMinus();
-            }
+    constexpr auto mul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
+        {
+            return generic::mul_1(rp, ap, n, b);
+        }
 
-            auto posRhs = rhs.isNegative ? -rhs : rhs;
+        return kernels()->mul1(rp, ap, n, b);
+    }
 
-            if (lhs.binNumber.size() >= posRhs.binNumber.size())
-            {
-                mod(lhs, posRhs);
-            }
+    constexpr auto addmul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
+        {
+            return generic::addmul_1(rp, ap, n, b);
+        }
 
-            if (isLhsNegative)
-            {
-                lhs.unaryMinus();
-            }
+        return kernels()->addmul1(rp, ap, n, b);
+    }
 
-            return lhs;
+    constexpr auto submul_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
+        {
+            return generic::submul_1(rp, ap, n, b);
         }
 
-        auto pow_assign (const BigInt& rhs) -> BigInt
+        return kernels()->submul1(rp, ap, n, b);
+    }
+
+    // shifts left by 0 < shift < LimbBits, returns the bits shifted out. rp may equal ap or lie above it.
+    constexpr auto lshift(Limb* rp, const Limb* ap, std::size_t n, std::size_t shift) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
         {
-            if (rhs.isNegative)
-            {
-                throw std::invalid_argument("right operand is negative.");
-            }
+            return generic::lshift(rp, ap, n, shift);
+        }
 
-            auto&& lhs = *this;
+        return kernels()->lshift(rp, ap, n, shift);
+    }
 
-            if (lhs.isZero())
-            {
-                return lhs;
-            }
+    // shifts right by 0 < shift < LimbBits, returns the bits shifted out in the high end of a limb.
+    // rp may equal ap or lie below it.
+    constexpr auto rshift(Limb* rp, const Limb* ap, std::size_t n, std::size_t shift) noexcept -> Limb
+    {
+        if (std::is_constant_evaluated())
+        {
+            return generic::rshift(rp, ap, n, shift);
+        }
 
-            if (rhs.isZero())
-            {
-                BigInt("1").swap(lhs);
+        return kernels()->rshift(rp, ap, n, shift);
+    }
 
-                return lhs;
-            }
+    constexpr auto add_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+    {
+        for (auto i = 0zu; i < n; i++)
+        {
+            rp[i] = ap[i] + b;
 
-            BigInt tmp;
+            b = rp[i] < b;
+        }
 
-            tmp.swap(lhs);
+        return b;
+    }
 
-            BigInt("1").swap(lhs);
+    // rp[0, an) = ap[0, an) + bp[0, bn), requires an >= bn.
+    constexpr auto add(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept -> Limb
+    {
+        const auto carry = add_n(rp, ap, bp, bn);
 
-            const auto rhsLength = rhs.binNumber.size();
+        return add_1(rp + bn, ap + bn, an - bn, carry);
+    }
 
-            for (auto i = 0zu; i < rhsLength; i++)
-            {
-                if (rhs.binNumber[i])
-                {
-                    lhs *= tmp;
-                }
+    constexpr auto sub_1(Limb* rp, const Limb* ap, std::size_t n, Limb b) noexcept -> Limb
+    {
+        for (auto i = 0zu; i < n; i++)
+        {
+            const auto a = ap[i];
 
-                tmp *= tmp;
-            }
+            rp[i] = a - b;
 
-            return lhs;
+            b = a < b;
         }
 
-        auto operator&= (const BigInt& rhs) -> BigInt&
-        {
-            auto&& lhs = *this;
+        return b;
+    }
 
-            if (lhs.isZero() || rhs.isNOne())
-            {
-                return lhs;
-            }
+    // rp[0, an) = ap[0, an) - bp[0, bn), requires an >= bn.
+    constexpr auto sub(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept -> Limb
+    {
+        const auto borrow = sub_n(rp, ap, bp, bn);
 
-            if (rhs.isZero() || lhs.isNOne())
-            {
-                return lhs = rhs;
-            }
+        return sub_1(rp + bn, ap + bn, an - bn, borrow);
+    }
 
-            if (lhs == rhs)
-            {
-                return lhs;
-            }
+    // rp[0, an + bn) = ap[0, an) * bp[0, bn), rp must not overlap the operands.
+    constexpr void mul_basecase(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) noexcept
+    {
+        rp[an] = mul_1(rp, ap, an, bp[0]);
 
-            return lhs.bitwiseOpr(rhs, [](auto&& lhs_, auto&& rhs_) noexcept
-                                  {
-                                      return lhs_ & rhs_;
-                                  });
-        }
-        auto operator|= (const BigInt& rhs) -> BigInt&
+        for (auto i = 1zu; i < bn; i++)
         {
-            auto&& lhs = *this;
+            rp[an + i] = addmul_1(rp + i, ap, an, bp[i]);
+        }
+    }
 
-            if (rhs.isZero() || lhs.isNOne())
-            {
-                return lhs;
-            }
+    // Moller and Granlund's reciprocal floor((B^2 - 1) / d) - B of a normalized d, with which a division by d
+    // takes two multiplications instead of a hardware division.
+    constexpr auto reciprocal_limb(Limb d) noexcept -> Limb
+    {
+        auto rem = Limb(0);
 
-            if (lhs.isZero() || rhs.isNOne())
-            {
-                return lhs = rhs;
-            }
+        return div_wide(~d, ~Limb(0), d, rem);
+    }
 
-            if (lhs == rhs)
-            {
-                return lhs;
-            }
+    // divides (hi:lo) by a normalized d whose reciprocal is v, requires hi < d.
+    constexpr auto div_preinv(Limb hi, Limb lo, Limb d, Limb v, Limb& rem) noexcept -> Limb
+    {
+        auto q1 = Limb(0);
 
-            return lhs.bitwiseOpr(rhs, [](auto&& lhs_, auto&& rhs_) noexcept
-                                  {
-                                      return lhs_ | rhs_;
-                                  });
+        auto q0 = mul_wide(v, hi, q1);
+
+        q0 += lo;
+        q1 += hi + 1 + (q0 < lo);
+
+        auto r = lo - q1 * d;
+
+        if (r > q0)
+        {
+            q1--;
+            r += d;
         }
-        auto operator^= (const BigInt& rhs) -> BigInt&
+
+        if (r >= d)
         {
-            auto&& lhs = *this;
+            q1++;
+            r -= d;
+        }
 
-            if (rhs.isZero())
-            {
-                return lhs;
-            }
+        rem = r;
 
-            if (rhs.isNOne())
-            {
-                return lhs.bitwiseNot();
-            }
+        return q1;
+    }
 
-            if (lhs.isZero())
-            {
-                lhs = rhs;
+    // qp[0, n) = ap[0, n) / d, returns the remainder. dn = d << shift is normalized and v is its reciprocal.
+    // qp may be ap.
+    constexpr auto divrem_1_preinv(Limb* qp, const Limb* ap, std::size_t n, Limb dn, std::size_t shift, Limb v) noexcept -> Limb
+    {
+        if (n == 0)
+        {
+            return 0;
+        }
 
-                return lhs;
-            }
+        auto rem = shift == 0 ? Limb(0) : ap[n - 1] >> (LimbBits - shift);
 
-            if (lhs.isNOne())
-            {
-                lhs = rhs;
+        for (auto i = n; i > 0; i--)
+        {
+            const auto lo = shift == 0 ? ap[i - 1] : (ap[i - 1] << shift) | (i > 1 ? ap[i - 2] >> (LimbBits - shift) : 0);
 
-                return lhs.bitwiseNot();
-            }
+            qp[i - 1] = div_preinv(rem, lo, dn, v, rem);
+        }
 
-            if (lhs == rhs)
-            {
-                BigInt("0").swap(lhs);
+        return rem >> shift;
+    }
 
-                return lhs;
-            }
+    constexpr auto divrem_1(Limb* qp, const Limb* ap, std::size_t n, Limb d) noexcept -> Limb
+    {
+        const auto shift = static_cast<std::size_t>(std::countl_zero(d));
 
-            return lhs.bitwiseOpr(rhs, [](auto&& lhs_, auto&& rhs_) noexcept
-                                  {
-                                      return lhs_ ^ rhs_;
-                                  });
+        return divrem_1_preinv(qp, ap, n, d << shift, shift, reciprocal_limb(d << shift));
+    }
+
+    // the inverse of an odd d modulo B, by Newton's iteration: d * d = 1 modulo 8 and every step doubles the good bits.
+    constexpr auto binvert_limb(Limb d) noexcept -> Limb
+    {
+        auto inv = d;
+
+        for (auto bits = 3zu; bits < LimbBits; bits *= 2)
+        {
+            inv *= 2 - d * inv;
         }
 
-        auto operator<<=(std::size_t shift) -> BigInt&
+        return inv;
+    }
+
+    // qp[0, n) = ap[0, n) / d for an odd d that divides it, from the low limb up (Hensel division), which needs no
+    // quotient estimate. Modulo B^n it also divides two's complement values exactly.
+    constexpr void divexact_1(Limb* qp, const Limb* ap, std::size_t n, Limb d) noexcept
+    {
+        const auto inv = binvert_limb(d);
+
+        auto carry = Limb(0);
+
+        for (auto i = 0zu; i < n; i++)
         {
-            auto&& lhs = *this;
+            const auto a = ap[i];
 
-            if (shift > 0)
-            {
-                lhs.binNumber.resize(lhs.binNumber.size() + shift);
+            const auto q = (a - carry) * inv;
 
-                lhs.binNumber <<= shift;
-            }
+            auto hi = Limb(0);
 
-            return lhs;
+            mul_wide(q, d, hi);
+
+            carry = hi + (a < carry);
+
+            qp[i] = q;
         }
-        auto operator<<=(const BigInt& rhs) -> BigInt&
-        {
-            if (rhs.isNegative)
-            {
-                throw std::invalid_argument("right operand is negative.");
-            }
-
-            auto&& lhs = *this;
-
-            lhs <<= rhs.ToInteger<std::size_t>();
+    }
 
-            return lhs;
-        }
+    // qp[0, qn) = ap / dp[0, dn) for an odd dp[0] and a dp that divides ap, Jebelean's exact division: each
+    // quotient limb is ap[i] * dp[0]^-1 modulo B and only the qn low limbs of ap are ever updated, so nothing
+    // above the quotient is computed and no remainder is corrected. ap[0, qn) is destroyed, qp may be ap.
+    constexpr void divexact(Limb* qp, Limb* ap, std::size_t qn, const Limb* dp, std::size_t dn) noexcept
+    {
+        const auto inv = binvert_limb(dp[0]);
 
-        auto operator>>=(std::size_t shift) -> BigInt&
+        for (auto i = 0zu; i < qn; i++)
         {
-            auto&& lhs = *this;
+            const auto q = ap[i] * inv;
 
-            if (shift > 0)
-            {
-                if (lhs.binNumber.size() > shift)
-                {
-                    lhs.binNumber >>= shift;
+            const auto len = std::min(dn, qn - i);
 
-                    lhs.binNumber.resize(lhs.binNumber.size() - shift);
-                }
-                else
-                {
-                    binNumber.clear();
-                }
-            }
+            auto borrow = submul_1(ap + i, dp, len, q);
 
-            return lhs;
-        }
-        auto operator>>=(const BigInt& rhs) -> BigInt&
-        {
-            if (rhs.isNegative)
+            for (auto j = i + len; borrow != 0 && j < qn; j++)
             {
-                throw std::invalid_argument("right operand is negative.");
-            }
+                const auto a = ap[j];
 
-            auto&& lhs = *this;
+                ap[j] = a - borrow;
 
-            lhs >>= rhs.ToInteger<std::size_t>();
+                borrow = a < borrow;
+            }
 
-            return lhs;
+            qp[i] = q;
         }
+    }
 
-        auto operator++ (   ) -> BigInt&
-        {
-            auto&& rhs = *this;
+    // the loop of Knuth's algorithm D on normalized operands: qp[0, an - dn + 1) = un / vn, leaving the remainder
+    // in un[0, dn). requires an >= dn >= 2, vn[dn - 1] to have its top bit set, un to have an + 1 limbs with
+    // un[an] < vn[dn - 1] and v to be the reciprocal of vn[dn - 1].
+    constexpr void divrem_preinv(Limb* qp, Limb* un, std::size_t an, const Limb* vn, std::size_t dn, Limb v) noexcept
+    {
+        const auto v1 = vn[dn - 1];
+        const auto v0 = vn[dn - 2];
 
-            return rhs += 1;
-        }
-        auto operator++ (int) -> BigInt
+        for (auto j = an - dn + 1; j > 0;)
         {
-            auto&& lhs = *this;
+            j--;
 
-            BigInt tmp(lhs);
+            const auto u2 = un[j + dn];
+            const auto u1 = un[j + dn - 1];
+            const auto u0 = un[j + dn - 2];
 
-            ++lhs;
+            auto qhat = Limb(0);
+            auto rhat = Limb(0);
 
-            return tmp;
-        }
+            auto isOverflow = false;
 
-        auto operator-- (   ) -> BigInt&
-        {
-            auto&& rhs = *this;
+            if (u2 >= v1)
+            {
+                qhat = ~Limb(0);
+                rhat = u1 + v1;
 
-            return rhs -= 1;
-        }
-        auto operator-- (int) -> BigInt
-        {
-            auto&& lhs = *this;
+                isOverflow = rhat < u1;
+            }
+            else
+            {
+                qhat = div_preinv(u2, u1, v1, v, rhat);
+            }
 
-            BigInt tmp(lhs);
+            for (; !isOverflow;)
+            {
+                auto hi = Limb(0);
 
-            --lhs;
+                const auto lo = mul_wide(qhat, v0, hi);
 
-            return tmp;
-        }
+                if (hi < rhat || (hi == rhat && lo <= u0))
+                {
+                    break;
+                }
 
-        public:
-        friend auto operator+ (const BigInt& rhs) noexcept -> const BigInt&
-        {
-            return rhs;
-        }
-        friend auto operator- (const BigInt& rhs) -> BigInt
-        {
-            return BigInt(rhs).unaryMinus();
-        }
-        friend auto operator~ (const BigInt& rhs) -> BigInt
-        {
-            return BigInt(rhs).bitwiseNot();
-        }
+                qhat--;
+                rhat += v1;
 
-        friend auto operator+ (const BigInt& lhs, const BigInt& rhs) -> BigInt
-        {
-            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
-                               {
-                                   return lhs_ += rhs_;
-                               });
-        }
-        friend auto operator- (const BigInt& lhs, const BigInt& rhs) -> BigInt
-        {
-            if (rhs.isZero())
-            {
-                return  lhs;
+                isOverflow = rhat < v1;
             }
 
-            if (lhs.isZero())
-            {
-                return -rhs;
-            }
+            const auto borrow = submul_1(un + j, vn, dn, qhat);
 
-            if (lhs == rhs)
+            un[j + dn] = u2 - borrow;
+
+            if (u2 < borrow)
             {
-                return BigInt("0");
+                qhat--;
+
+                un[j + dn] += add_n(un + j, un + j, vn, dn);
             }
 
-            return lhs + -rhs;
-        }
-        friend auto operator* (const BigInt& lhs, const BigInt& rhs) -> BigInt
-        {
-            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
-                               {
-                                   return lhs_ *= rhs_;
-                               });
+            qp[j] = qhat;
         }
-        friend auto operator/ (const BigInt& lhs, const BigInt& rhs) -> BigInt
+    }
+
+    // Knuth's algorithm D: qp[0, an - dn + 1) = ap / dp, rp[0, dn) = ap % dp.
+    // requires an >= dn >= 2, dp[dn - 1] != 0, un has an + 1 limbs and vn has dn limbs of scratch.
+    constexpr void divrem(Limb* qp, Limb* rp, const Limb* ap, std::size_t an, const Limb* dp, std::size_t dn,
+                          Limb* un, Limb* vn) noexcept
+    {
+        const auto shift = static_cast<std::size_t>(std::countl_zero(dp[dn - 1]));
+
+        if (shift > 0)
         {
-            return BigInt(lhs) /= rhs;
+            lshift(vn, dp, dn, shift);
+
+            un[an] = lshift(un, ap, an, shift);
         }
-        friend auto operator% (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        else
         {
-            return BigInt(lhs) %= rhs;
-        }
+            std::copy(dp, dp + dn, vn);
+            std::copy(ap, ap + an, un);
 
-        friend auto operator& (const BigInt& lhs, const BigInt& rhs) -> BigInt
-        {
-            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
-                               {
-                                   return lhs_ &= rhs_;
-                               });
+            un[an] = 0;
         }
-        friend auto operator| (const BigInt& lhs, const BigInt& rhs) -> BigInt
+
+        divrem_preinv(qp, un, an, vn, dn, reciprocal_limb(vn[dn - 1]));
+
+        if (shift > 0)
         {
-            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
-                               {
-                                   return lhs_ |= rhs_;
-                               });
+            rshift(rp, un, dn, shift);
         }
-        friend auto operator^ (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        else
         {
-            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
-                               {
-                                   return lhs_ ^= rhs_;
-                               });
+            std::copy(un, un + dn, rp);
         }
+    }
 
-        friend auto operator<<(const BigInt& lhs, std::size_t shift) -> BigInt
+    constexpr auto char_to_digit(char c) noexcept -> int
+    {
+        if ('0' <= c && c <= '9')
         {
-            return BigInt(lhs) <<=shift;
+            return c - '0';
         }
-        friend auto operator>>(const BigInt& lhs, std::size_t shift) -> BigInt
+        else if ('A' <= c && c <= 'Z')
         {
-            return BigInt(lhs) >>=shift;
+            return c - 'A' + 10;
         }
-
-        friend auto operator<<(const BigInt& lhs, const BigInt& rhs) -> BigInt
+        else if ('a' <= c && c <= 'z')
         {
-            return BigInt(lhs) <<=rhs;
+            return c - 'a' + 10;
         }
-        friend auto operator>>(const BigInt& lhs, const BigInt& rhs) -> BigInt
+        else
         {
-            return BigInt(lhs) >>=rhs;
+            return -1;
         }
+    }
 
-        friend auto operator==(const BigInt& lhs, const BigInt& rhs) -> bool
-        {
-            if (lhs.isNegative != rhs.isNegative)
-            {
-                return false;
-            }
+    constexpr auto digit_to_char(int d) noexcept -> char
+    {
+        return static_cast<char>(d < 10 ? d + '0' : d - 10 + 'A');
+    }
 
-            const auto lhsLength = lhs.binNumber.size();
+    struct ParsedPrefix final
+    {
+        std::string_view digits;
 
-            const auto rhsLength = rhs.binNumber.size();
+        int              base       = 10;
 
-            if (lhsLength != rhsLength)
-            {
-                return false;
-            }
-            else
-            {
-                return lhs.binNumber == rhs.binNumber;
-            }
-        }
-        friend auto operator!=(const BigInt& lhs, const BigInt& rhs) -> bool
+        bool             isNegative = false;
+    };
+
+    // strips signs and base prefixes the same way the BigInt string constructor does.
+    constexpr auto parse_prefix(std::string_view numStrView, std::optional<int> base) -> ParsedPrefix
+    {
+        auto ret = ParsedPrefix {};
+
+        for (; !numStrView.empty() && (numStrView.front() == '+' || numStrView.front() == '-');)
         {
-            return !(lhs == rhs);
+            ret.isNegative = ret.isNegative || numStrView.front() == '-';
+
+            numStrView.remove_prefix(1);
         }
 
-        friend auto operator< (const BigInt& lhs, const BigInt& rhs) -> bool
+        if (base.has_value())
         {
-            if (lhs.isNegative != rhs.isNegative)
+            if (!(2 <= base.value() && base.value() <= 36))
             {
-                return lhs.isNegative;
+                throw std::invalid_argument("base is invalid.");
             }
 
-            const auto lhsLength = lhs.binNumber.size();
-
-            const auto rhsLength = rhs.binNumber.size();
+            ret.base = base.value();
+        }
+        else if (numStrView.size() > 1 && numStrView.front() == '0')
+        {
+            numStrView.remove_prefix(1);
 
-            if (lhsLength != rhsLength)
-            {
-                return lhs.isNegative != (lhsLength < rhsLength);
-            }
-            else
+            switch (numStrView.front())
             {
-                return lhs.binNumber <  rhs.binNumber;
+                case 'B':
+                    [[fallthrough]];
+                case 'b':
+                    ret.base = 0B10;
+                    numStrView.remove_prefix(1);
+                    break;
+                case 'X':
+                    [[fallthrough]];
+                case 'x':
+                    ret.base = 0X10;
+                    numStrView.remove_prefix(1);
+                    break;
+                default:
+                    ret.base = 010;
+                    break;
             }
         }
-        friend auto operator>=(const BigInt& lhs, const BigInt& rhs) -> bool
-        {
-            return !(lhs <  rhs);
-        }
-        friend auto operator> (const BigInt& lhs, const BigInt& rhs) -> bool
-        {
-            return   rhs <  lhs;
-        }
-        friend auto operator<=(const BigInt& lhs, const BigInt& rhs) -> bool
+
+        if (numStrView.empty() || !std::ranges::all_of(numStrView, [&ret](char c_)
+                                                      {
+                                                          const auto digit_ = char_to_digit(c_);
+
+                                                          return 0 <= digit_ && digit_ < ret.base;
+                                                      }))
         {
-            return !(rhs <  lhs);
+            throw std::invalid_argument("character is invalid.");
         }
 
-        friend auto operator>>(std::istream& lhs,       BigInt& rhs) -> std::istream&
-        {
-            auto stdString = std::string();
+        ret.digits = numStrView;
 
-            lhs >> stdString;
+        return ret;
+    }
 
-            BigInt(stdString).swap(rhs);
+    // accumulates the digits into the magnitude rp[0, n) modulo 2^(n * LimbBits), returns false if it did not fit.
+    constexpr auto parse_magnitude(Limb* rp, std::size_t n, std::string_view digits, int base) noexcept -> bool
+    {
+        auto isFit = true;
 
-            return lhs;
-        }
+        std::fill(rp, rp + n, Limb(0));
 
-        friend auto operator<<(std::ostream& lhs, const BigInt& rhs) -> std::ostream&
+        for (auto&& c : digits)
         {
-            return lhs << rhs.ToStdString();
+            auto carry = mul_1(rp, rp, n, static_cast<Limb>(base));
+
+            carry += add_1(rp, rp, n, static_cast<Limb>(char_to_digit(c)));
+
+            isFit = isFit && carry == 0;
         }
 
-        public:
-        void swap(BigInt& rhs) noexcept
-        {
-            auto&& lhs = *this;
+        return isFit;
+    }
 
-            auto lhsPair = std::tie(lhs.binNumber, lhs.isNegative);
+    template<std::size_t N>
+    struct LiteralChars final
+    {
+        std::array<char, N> chars {};
 
-            auto rhsPair = std::tie(rhs.binNumber, rhs.isNegative);
+        std::size_t         size = 0;
+    };
 
-            lhsPair.swap(rhsPair);
-        }
+    // the characters of a numeric literal without digit separators.
+    template<char... C>
+    consteval auto literal_chars()
+    {
+        auto ret = LiteralChars<sizeof...(C)> {};
 
-        public:
-        template<std::integral T>
-        auto ToInteger  () const -> T
+        for (auto&& c : { C... })
         {
-            if constexpr (std::is_unsigned_v<T>)
+            if (c != '\'')
             {
-                if (isNegative)
-                {
-                    throw std::invalid_argument("unsigned integer is negative.");
-                }
+                ret.chars[ret.size++] = c;
             }
+        }
 
-            auto decString = ToStdString();
+        return ret;
+    }
 
-            auto decNumber = T {};
+    template<std::size_t N>
+    struct LiteralMagnitude final
+    {
+        std::array<Limb, N> limbs {};
 
-            const auto result = std::from_chars(decString.c_str(), decString.c_str() + decString.size(), decNumber);
+        std::size_t         size = 0;
+    };
 
-            if (result.ec == std::errc::result_out_of_range)
-            {
-                throw std::out_of_range("integer out of range.");
-            }
+    // a literal digit takes at most 4 bits, which bounds the limbs of its magnitude.
+    template<char... C>
+    consteval auto parse_literal()
+    {
+        const auto literal = literal_chars<C...>();
 
-            return decNumber;
-        }
+        const auto parsed = parse_prefix(std::string_view(literal.chars.data(), literal.size), std::nullopt);
 
-        public:
-        auto ToBinString() const -> std::string
-        {
-            auto binString = std::string(binNumber.size(), '0');
+        auto ret = LiteralMagnitude<sizeof...(C) * 4 / LimbBits + 1> {};
 
-            boost::to_string(binNumber, binString);
+        parse_magnitude(ret.limbs.data(), ret.limbs.size(), parsed.digits, parsed.base);
 
-            return binString;
-        }
+        ret.size = normalized_size(ret.limbs.data(), ret.limbs.size());
 
-        auto ToStdString(int base = 10) const -> std::string
+        return ret;
+    }
+}
+
+#if __has_include("bigint_tuning.hh")
+#include "bigint_tuning.hh"
+#endif
+
+#ifndef D_AKR_BIGINT_MUL_KARATSUBA
+#define D_AKR_BIGINT_MUL_KARATSUBA 32
+#endif
+
+#ifndef D_AKR_BIGINT_MUL_TOOM
+#define D_AKR_BIGINT_MUL_TOOM      256
+#endif
+
+#ifndef D_AKR_BIGINT_DIV_RECURSIVE
+#define D_AKR_BIGINT_DIV_RECURSIVE 48
+#endif
+
+#ifndef D_AKR_BIGINT_RADIX_DIVIDE
+#define D_AKR_BIGINT_RADIX_DIVIDE  24
+#endif
+
+namespace akr::detail
+{
+    // sizes are in limbs. The defaults come from bigint_tuning.hh when tune/bigint_tune has written one.
+    struct Thresholds final
+    {
+        std::size_t mulKaratsuba = D_AKR_BIGINT_MUL_KARATSUBA;
+
+        std::size_t mulToom      = D_AKR_BIGINT_MUL_TOOM;
+
+        std::size_t divRecursive = D_AKR_BIGINT_DIV_RECURSIVE;
+
+        std::size_t radixDivide  = D_AKR_BIGINT_RADIX_DIVIDE;
+
+        std::size_t parallel     = 1024;
+    };
+
+    inline auto thresholds() noexcept -> Thresholds&
+    {
+        static auto ret = Thresholds {};
+
+        return ret;
+    }
+
+    // what D_AKR_BIGINT_STATS counts on one thread. sizes[op][i] counts the calls whose larger operand has a bit width
+    // of i, so bucket i holds operands of 2^(i-1) to 2^i - 1 bits. tiers count the calls of each algorithm, recursion included.
+    struct Stats final
+    {
+        enum Op   : std::size_t
         {
-            static const auto toBinString = [](auto&& bigInt_)
-            {
-                auto binString_ = std::string(bigInt_.binNumber.size(), '0');
+            Add, Sub, Mul, Div, Mod, DivExact, Pow, PowMod, Gcd, And, Or, Xor, Shift, Parse, Print, OpCount
+        };
 
-                if (!bigInt_.isNegative)
-                {
-                    boost::to_string(bigInt_.binNumber, binString_);
-                }
-                else
-                {
-                    const auto size_ = bigInt_.binNumber.size();
+        enum Tier : std::size_t
+        {
+            MulBasecase, MulChunked, MulKaratsuba, MulToom32, MulToom43,
+            DivBasecase, DivRecursive, DivHensel, RadixBasecase, RadixDivide, TierCount
+        };
 
-                    for (auto i_ = 0zu; i_ < size_; i_++)
-                    {
-                        binString_[i_] = bigInt_.binNumber[i_] ? '0' : '1';
-                    }
+        static constexpr auto SizeBuckets = LimbBits + 1;
 
-                    for (auto&& c_ : binString_)
-                    {
-                        c_ = (c_ == '0' ? '1' : '0');
+        std::array<std::uint64_t, OpCount> calls {};
 
-                        if (c_ == '1')
-                        {
-                            break;
-                        }
-                    }
+        std::array<std::array<std::uint64_t, SizeBuckets>, OpCount> sizes {};
 
-                    if (binString_.empty() || binString_.ends_with('0'))
-                    {
-                        binString_.push_back('1');
-                    }
+        std::array<std::uint64_t, TierCount> tiers {};
 
-                    std::ranges::reverse(binString_);
-                }
+        std::uint64_t allocations    = 0;
 
-                return binString_;
-            };
+        std::uint64_t deallocations  = 0;
 
-            if (!(2 <= base && base <= 36))
-            {
-                throw std::invalid_argument("base is invalid.");
-            }
+        std::uint64_t allocatedBytes = 0;
 
-            auto binString = toBinString(*this);
+        // the bytes this thread holds; storage freed on another thread than the one that allocated it moves them.
+        std::int64_t  liveBytes      = 0;
 
-            auto stdString = std::string();
+        std::int64_t  peakBytes      = 0;
+    };
 
-            auto tmpString = std::string();
+    inline auto stats() noexcept -> Stats&
+    {
+        static thread_local auto ret = Stats {};
 
-            const auto zeroString = std::string(binString.size(), '0');
+        return ret;
+    }
 
-            for (;;)
-            {
-                auto digit = 0;
+    inline void count_op(Stats::Op op, std::size_t bits) noexcept
+    {
+        auto&& s = stats();
 
-                for (auto&& c : binString)
-                {
-                    digit = digit * 2 + (c - '0');
+        s.calls[op]++;
 
-                    if (digit >= base)
-                    {
-                        tmpString.push_back('1');
+        s.sizes[op][static_cast<std::size_t>(std::bit_width(bits))]++;
+    }
 
-                        digit -= base;
-                    }
-                    else
-                    {
-                        tmpString.push_back('0');
-                    }
-                }
+    inline void count_allocation(std::size_t bytes) noexcept
+    {
+        auto&& s = stats();
 
-                stdString.push_back(digitToChar(digit));
+        s.allocations++;
 
-                tmpString.swap(binString);
+        s.allocatedBytes += bytes;
 
-                if (binString == zeroString)
-                {
-                    break;
-                }
+        s.liveBytes      += static_cast<std::int64_t>(bytes);
 
-                tmpString.clear();
-            }
+        s.peakBytes       = std::max(s.peakBytes, s.liveBytes);
+    }
 
-            if (isNegative)
-            {
-                stdString.push_back('-');
-            }
+    inline void count_deallocation(std::size_t bytes) noexcept
+    {
+        auto&& s = stats();
 
-            std::ranges::reverse(stdString);
+        s.deallocations++;
 
-            return stdString;
-        }
+        s.liveBytes -= static_cast<std::int64_t>(bytes);
+    }
+}
+
+#ifdef  D_AKR_BIGINT_STATS
+#define U_AKR_BIGINT_COUNT_OP(OP, BITS)    ::akr::detail::count_op(::akr::detail::Stats::OP, (BITS))
+#define U_AKR_BIGINT_COUNT_TIER(TIER)      (::akr::detail::stats().tiers[::akr::detail::Stats::TIER]++)
+#define U_AKR_BIGINT_COUNT_ALLOCATION(N)   ::akr::detail::count_allocation(N)
+#define U_AKR_BIGINT_COUNT_DEALLOCATION(N) ::akr::detail::count_deallocation(N)
+#else
+#define U_AKR_BIGINT_COUNT_OP(OP, BITS)    static_cast<void>(0)
+#define U_AKR_BIGINT_COUNT_TIER(TIER)      static_cast<void>(0)
+#define U_AKR_BIGINT_COUNT_ALLOCATION(N)   static_cast<void>(0)
+#define U_AKR_BIGINT_COUNT_DEALLOCATION(N) static_cast<void>(0)
+#endif//D_AKR_BIGINT_STATS
+
+namespace akr::detail
+{
+    struct ResourceState final
+    {
+        std::pmr::memory_resource* resource = nullptr;
+
+        // whether pool threads working for this thread may allocate from the resource too.
+        bool                       isShared = true;
+    };
+
+    // the resource every BigInt and temporary allocates from on this thread, null means the pmr default resource.
+    inline auto resource_state() noexcept -> ResourceState&
+    {
+        static thread_local auto ret = ResourceState {};
+
+        return ret;
+    }
+
+    inline auto current_resource() noexcept -> std::pmr::memory_resource*
+    {
+        const auto resource = resource_state().resource;
+
+        return resource != nullptr ? resource : std::pmr::get_default_resource();
+    }
 
+    struct ResourceGuard final
+    {
         private:
-        auto bitwiseNot () -> BigInt&
+        ResourceState saved;
+
+        public:
+        explicit ResourceGuard(ResourceState state) noexcept:
+            saved(std::exchange(resource_state(), state))
         {
-            auto&& rhs = *this;
+        }
 
-            rhs.isNegative = !rhs.isNegative;
+        ResourceGuard(const ResourceGuard&) = delete;
 
-            rhs.binNumber.flip();
+        auto operator=(const ResourceGuard&) -> ResourceGuard& = delete;
 
-            return rhs;
+        ~ResourceGuard()
+        {
+            resource_state() = saved;
         }
+    };
 
-        template<class F>
-        auto bitwiseOpr (const BigInt& rhs, const F& func) -> BigInt&
+    // like std::pmr::polymorphic_allocator, but defaults to the resource of the current thread. Assignments keep the
+    // resource of the target and copy across when the resources differ, so a value assigned or updated inside a
+    // ResourceScope stays where it was. Swaps still carry the storage along, so values built in different resources
+    // can be swapped.
+    template<class T>
+    struct Allocator
+    {
+        using value_type                             = T;
+
+        using propagate_on_container_copy_assignment = std::false_type;
+
+        using propagate_on_container_move_assignment = std::false_type;
+
+        using propagate_on_container_swap            = std::true_type;
+
+        std::pmr::memory_resource* resource;
+
+        Allocator() noexcept:
+            resource(current_resource())
         {
-            auto&& lhs = *this;
+        }
 
-            Trim trim;
+        Allocator(std::pmr::memory_resource* resource) noexcept:
+            resource(resource)
+        {
+        }
 
-            forEachBit(rhs, [&func, &trim](bool lhs_, bool rhs_) noexcept
-                       {
-                           const auto newBit_ = func(lhs_, rhs_);
+        template<class U>
+        Allocator(const Allocator<U>& other) noexcept:
+            resource(other.resource)
+        {
+        }
 
-                           trim.Count(newBit_);
+        auto allocate  (std::size_t n) -> T*
+        {
+            const auto ret = static_cast<T*>(resource->allocate(n * sizeof(T), alignof(T)));
 
-                           return newBit_;
-                       });
+            U_AKR_BIGINT_COUNT_ALLOCATION(n * sizeof(T));
 
-            lhs.isNegative = func(lhs.isNegative, rhs.isNegative);
+            return ret;
+        }
 
-            if (lhs.isNegative)
-            {
-                lhs.binNumber.push_back(lhs.isNegative);
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            U_AKR_BIGINT_COUNT_DEALLOCATION(n * sizeof(T));
 
-                trim.Count(lhs.isNegative);
-            }
+            resource->deallocate(p, n * sizeof(T), alignof(T));
+        }
 
-            trim(lhs);
+        // copies land in the resource of the copying thread, not in the one of the source.
+        auto select_on_container_copy_construction() const noexcept -> Allocator
+        {
+            return Allocator();
+        }
 
-            return lhs;
+        template<class U>
+        friend auto operator==(const Allocator& lhs, const Allocator<U>& rhs) noexcept -> bool
+        {
+            return lhs.resource == rhs.resource || lhs.resource->is_equal(*rhs.resource);
         }
+    };
 
-        template<class F>
-        void forEachBit (const BigInt& rhs, const F& func)
+    // a fork-join pool: every thread owns a deque, pops its own jobs from the back and steals from the front of the others.
+    // a thread waiting for a forked job keeps running jobs until it is done, so nested forks never block a worker.
+    struct TaskPool final
+    {
+        private:
+        struct Job final
         {
-            auto&& lhs = *this;
+            std::function<void()> func;
 
-            const auto lhsLength = lhs.binNumber.size();
+            std::exception_ptr    error;
 
-            const auto rhsLength = rhs.binNumber.size();
+            std::atomic<bool>     isDone = false;
+        };
 
-            const auto minLength = std::min(lhsLength, rhsLength);
+        struct Queue final
+        {
+            std::mutex       mutex;
 
-            auto i = 0zu;
+            std::deque<Job*> jobs;
+        };
 
-            for (; i < minLength; i++)
+        private:
+        std::vector<std::thread>  threads;
+
+        std::vector<Queue>        queues;
+
+        std::atomic<std::size_t>  pending = 0;
+
+        std::atomic<bool>         isStop  = false;
+
+        std::mutex                sleepMutex;
+
+        std::condition_variable   sleepCond;
+
+        public:
+        explicit TaskPool(std::size_t workerCount):
+            queues(workerCount + 1)
+        {
+            threads.reserve(workerCount);
+
+            for (auto i = 0zu; i < workerCount; i++)
             {
-                lhs.binNumber[i] = func(lhs.binNumber[i], rhs.binNumber[i]);
+                threads.emplace_back([this, i] { work(i); });
             }
+        }
+
+        TaskPool(const TaskPool&) = delete;
+
+        auto operator=(const TaskPool&) -> TaskPool& = delete;
+
+        ~TaskPool()
+        {
+            isStop = true;
 
-            if (lhsLength >= rhsLength)
             {
-                for (; i < lhsLength; i++)
-                {
-                    lhs.binNumber[i] = func(lhs.binNumber[i], rhs.isNegative);
-                }
+                const auto lock = std::lock_guard(sleepMutex);
             }
-            else
-            {
-                lhs.binNumber.resize(rhsLength);
 
-                for (; i < rhsLength; i++)
-                {
-                    lhs.binNumber[i] = func(rhs.binNumber[i], lhs.isNegative);
-                }
+            sleepCond.notify_all();
+
+            for (auto&& e : threads)
+            {
+                e.join();
             }
         }
 
-        auto unaryMinus () -> BigInt&
+        public:
+        auto size() const noexcept -> std::size_t
         {
-            static const auto twosComplement = [](auto&& bigInt_)
+            return threads.size() + 1;
+        }
+
+        // runs lhs on the calling thread while rhs may be stolen by another one, returns when both are done.
+        template<class F, class G>
+        void fork_join(const F& lhs, const G& rhs)
+        {
+            const auto state = resource_state();
+
+            if (!state.isShared)
             {
-                bigInt_.binNumber.flip();
+                lhs();
+                rhs();
 
-                const auto size_ = bigInt_.binNumber.size();
+                return;
+            }
 
-                for (auto i_ = 0zu; i_ < size_; i_++)
-                {
-                    bigInt_.binNumber[i_].flip();
+            auto job = Job {};
 
-                    if (bigInt_.binNumber[i_] == 1)
-                    {
-                        break;
-                    }
-                }
+            job.func = [&rhs, state]
+            {
+                const auto guard_ = ResourceGuard(state);
 
-                if (!bigInt_.isNegative)
-                {
-                    if (bigInt_.binNumber[size_ - 1] == 0)
-                    {
-                        bigInt_.binNumber.resize(size_ + 1, 1);
-                    }
-                }
-                else
-                {
-                    if (bigInt_.binNumber[size_ - 1] == 1)
-                    {
-                        bigInt_.binNumber.resize(size_ - 1, 0);
-                    }
-                }
+                rhs();
             };
 
-            auto&& rhs = *this;
+            push(&job);
 
-            if (rhs.isZero())
+            auto error = std::exception_ptr();
+
+            try
             {
-                return rhs;
+                lhs();
             }
-
-            if (rhs.isNOne())
+            catch (...)
             {
-                BigInt("1").swap(rhs);
-
-                return rhs;
+                error = std::current_exception();
             }
 
-            rhs.isNegative = !rhs.isNegative;
+            for (; !job.isDone.load(std::memory_order_acquire);)
+            {
+                if (!runOne())
+                {
+                    std::this_thread::yield();
+                }
+            }
 
-            twosComplement(rhs);
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
 
-            return rhs;
+            if (job.error)
+            {
+                std::rethrow_exception(job.error);
+            }
         }
 
         private:
-        auto isNOne     () const noexcept -> bool
+        static auto current() noexcept -> std::pair<TaskPool*, std::size_t>&
         {
-            return binNumber.empty() &&  isNegative;
+            static thread_local auto ret = std::pair<TaskPool*, std::size_t>(nullptr, 0);
+
+            return ret;
         }
 
-        auto isZero     () const noexcept -> bool
+        auto ownQueue() noexcept -> std::size_t
         {
-            return binNumber.empty() && !isNegative;
+            const auto [pool, index] = current();
+
+            return pool == this ? index : queues.size() - 1;
         }
 
-        private:
-        template<class F>
-        static auto bigOprSmall(const BigInt& lhs, const BigInt& rhs, const F& func) -> BigInt
+        void push(Job* job)
         {
-            if (lhs.binNumber.size() >= rhs.binNumber.size())
             {
-                return func(BigInt(lhs), rhs);
+                auto&& queue = queues[ownQueue()];
+
+                const auto lock = std::lock_guard(queue.mutex);
+
+                queue.jobs.push_back(job);
             }
-            else
+
+            pending++;
+
             {
-                return func(BigInt(rhs), lhs);
+                const auto lock = std::lock_guard(sleepMutex);
             }
+
+            sleepCond.notify_one();
         }
 
-        private:
-        static auto digitToChar(int d) -> char
+        auto take() -> Job*
         {
-            if (0 <= d && d <= 9)
+            const auto own = ownQueue();
+
+            for (auto i = 0zu; i < queues.size(); i++)
             {
-                return static_cast<char>(d + '0');
+                auto&& queue = queues[(own + i) % queues.size()];
+
+                const auto lock = std::lock_guard(queue.mutex);
+
+                if (!queue.jobs.empty())
+                {
+                    auto job = i == 0 ? queue.jobs.back() : queue.jobs.front();
+
+                    if (i == 0)
+                    {
+                        queue.jobs.pop_back();
+                    }
+                    else
+                    {
+                        queue.jobs.pop_front();
+                    }
+
+                    pending--;
+
+                    return job;
+                }
             }
-            else if ('A' - 'A' + 10 <= d && d <= 'Z' - 'A' + 10)
+
+            return nullptr;
+        }
+
+        auto runOne() -> bool
+        {
+            auto job = take();
+
+            if (job == nullptr)
             {
-                return static_cast<char>(d + 'A' - 10);
+                return false;
             }
-            else if ('a' - 'a' + 10 <= d && d <= 'z' - 'a' + 10)
+
+            try
             {
-                return static_cast<char>(d + 'a' - 10);
+                job->func();
             }
-            else
+            catch (...)
             {
-                throw std::invalid_argument("character is invalid.");
+                job->error = std::current_exception();
+            }
+
+            job->isDone.store(true, std::memory_order_release);
+
+            return true;
+        }
+
+        void work(std::size_t index)
+        {
+            current() = { this, index };
+
+            for (;;)
+            {
+                if (runOne())
+                {
+                    continue;
+                }
+
+                auto lock = std::unique_lock(sleepMutex);
+
+                sleepCond.wait(lock, [this] { return isStop || pending > 0; });
+
+                if (isStop && pending == 0)
+                {
+                    return;
+                }
             }
         }
     };
 
-    inline static auto pow      (const akr::BigInt& lhs, const akr::BigInt& rhs) -> akr::BigInt
+    inline auto task_pool() noexcept -> std::unique_ptr<TaskPool>&
     {
-        return akr::BigInt(lhs).pow_assign(rhs);
+        static auto ret = std::unique_ptr<TaskPool>();
+
+        return ret;
     }
 
-    inline static auto to_string(const akr::BigInt& value) -> std::string
+    // runs both functions, in parallel if the pool is enabled and the operands are large enough.
+    template<class F, class G>
+    void fork_join(std::size_t size, const F& lhs, const G& rhs)
     {
-        return value.ToStdString();
+        if (auto&& pool = task_pool(); pool && size >= thresholds().parallel)
+        {
+            pool->fork_join(lhs, rhs);
+        }
+        else
+        {
+            lhs();
+            rhs();
+        }
     }
-}
 
-namespace std
-{
-    inline static auto pow      (const akr::BigInt& lhs, const akr::BigInt& rhs) -> akr::BigInt
+    using Nat = std::vector<Limb, Allocator<Limb>>;
+
+    inline void nat_trim(Nat& x)
     {
-        return akr::BigInt(lhs).pow_assign(rhs);
+        x.resize(normalized_size(x.data(), x.size()));
     }
 
-    inline static auto to_string(const akr::BigInt& value) -> std::string
+    // buffers a thread keeps between calls so that steady loops stop allocating. They come from the global heap, as they
+    // outlive every ResourceScope, and whoever uses one must not call anything that uses the same one.
+    struct Scratch final
     {
-        return value.ToStdString();
+        Nat a;
+
+        Nat b;
+
+        Nat q;
+
+        Nat r;
+
+        Nat un;
+
+        Nat vn;
+
+        Scratch():
+            a (heap()),
+            b (heap()),
+            q (heap()),
+            r (heap()),
+            un(heap()),
+            vn(heap())
+        {
+        }
+
+        static auto heap() noexcept -> Allocator<Limb>
+        {
+            return Allocator<Limb>(std::pmr::new_delete_resource());
+        }
+
+        // swaps made by the algorithms carry the allocator along, a buffer that came back with storage of another
+        // resource gives it up.
+        static void reclaim(Nat& x)
+        {
+            if (x.get_allocator().resource != std::pmr::new_delete_resource())
+            {
+                Nat(heap()).swap(x);
+            }
+        }
+    };
+
+    inline auto scratch() -> Scratch&
+    {
+        static thread_local auto ret = Scratch();
+
+        return ret;
     }
-}
 
-namespace akr::literals
-{
-    template<char... C>
-    inline auto operator""_akr_bigint() -> BigInt
+    // compares x with y * B^shift, both normalized.
+    inline auto nat_cmp(const Nat& x, const Nat& y, std::size_t shift = 0) noexcept -> int
     {
-        return std::initializer_list<char> { C... };
+        if (y.empty())
+        {
+            return x.empty() ? 0 : 1;
+        }
+
+        if (x.size() != y.size() + shift)
+        {
+            return x.size() < y.size() + shift ? -1 : 1;
+        }
+
+        if (const auto ret = cmp(x.data() + shift, y.data(), y.size()); ret != 0)
+        {
+            return ret;
+        }
+
+        return normalized_size(x.data(), shift) != 0 ? 1 : 0;
     }
-}
 
-#ifdef  D_AKR_TEST
-#include <random>
+    // x += y * B^shift.
+    inline void nat_add(Nat& x, const Limb* yp, std::size_t yn, std::size_t shift = 0)
+    {
+        yn = normalized_size(yp, yn);
 
-namespace akr::test
-{
-    AKR_TEST(BigInt,
+        if (yn == 0)
+        {
+            return;
+        }
+
+        if (x.size() < yn + shift)
+        {
+            x.resize(yn + shift);
+        }
+
+        if (const auto carry = add(x.data() + shift, x.data() + shift, x.size() - shift, yp, yn); carry != 0)
+        {
+            x.push_back(carry);
+        }
+    }
+
+    // x -= y * B^shift, requires x >= y * B^shift.
+    inline void nat_sub(Nat& x, const Limb* yp, std::size_t yn, std::size_t shift = 0)
     {
-        using namespace literals;
+        yn = normalized_size(yp, yn);
 
-        assert(0_akr_bigint == 0);
-        assert(BigInt(    ) == 0);
-        assert(BigInt(  0 ) == 0);
-        assert(BigInt( "0") == 0);
-        assert(BigInt("+0") == 0);
-        assert(BigInt("-0") == 0);
+        if (yn == 0)
+        {
+            return;
+        }
 
-        assert(BigInt() + 0 == 0);
-        assert(BigInt() - 0 == 0);
-        assert(BigInt() * 0 == 0);
+        sub(x.data() + shift, x.data() + shift, x.size() - shift, yp, yn);
 
-        using T = std::int32_t;
+        nat_trim(x);
+    }
 
-        auto rd = std::random_device();
-        auto re = std::mt19937_64(rd());
+    inline void mul(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn);
 
-        const auto sm = static_cast<T>(std::sqrt(std::numeric_limits<T>::max()));
+    // splits the longer operand into pieces as long as the shorter one, requires an >= bn.
+    inline void mul_chunked(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        auto tmp = Nat(bn * 2);
 
-        auto id = std::uniform_int_distribution<T>(-sm, sm);
+        std::fill(rp, rp + an + bn, Limb(0));
 
-        for (auto i = 0; i < 100; i++)
+        for (auto i = 0zu; i < an; i += bn)
         {
-            auto intNum = id(re);
+            const auto size = std::min(bn, an - i);
 
-            for (; intNum == 0;)
-            {
-                intNum = id(re);
-            }
+            mul(tmp.data(), ap + i, size, bp, bn);
 
-            // std::printf("[%07d] num: %6d, ", i, intNum);
+            add(rp + i, rp + i, an + bn - i, tmp.data(), size + bn);
+        }
+    }
 
-            auto bigNum = BigInt(intNum);
+    // (a1 B^h + a0)(b1 B^h + b0) = a1 b1 B^2h + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B^h + a0 b0,
+    // requires an >= bn > h = ceil(an / 2). The three products run in parallel for large operands.
+    inline void mul_karatsuba(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        const auto h = (an + 1) / 2;
+
+        auto sa = Nat(h + 1);
+        auto sb = Nat(h + 1);
+
+        sa[h] = add(sa.data(), ap, h, ap + h, an - h);
+        sb[h] = add(sb.data(), bp, h, bp + h, bn - h);
+
+        auto z1 = Nat((h + 1) * 2);
+
+        fork_join(an, [&]
+                  {
+                      mul(rp, ap, h, bp, h);
+                  },
+                  [&]
+                  {
+                      fork_join(an, [&]
+                                {
+                                    mul(rp + h * 2, ap + h, an - h, bp + h, bn - h);
+                                },
+                                [&]
+                                {
+                                    mul(z1.data(), sa.data(), h + 1, sb.data(), h + 1);
+                                });
+                  });
+
+        sub(z1.data(), z1.data(), z1.size(), rp, h * 2);
+        sub(z1.data(), z1.data(), z1.size(), rp + h * 2, an + bn - h * 2);
+
+        add(rp + h, rp + h, an + bn - h, z1.data(), normalized_size(z1.data(), z1.size()));
+    }
 
-            assert(bigNum == intNum && bigNum == std::to_string(intNum));
+    // Toom-Cook splits a into k and b into l pieces of n limbs, the top ones shorter, multiplies their polynomials at
+    // k + l - 1 points and interpolates the coefficients of the product. Point values are kept modulo B^w in two's
+    // complement, w leaves room for every sum below, so negative values need no sign of their own and divide exactly.
+    inline void toom_negate(Nat& x) noexcept
+    {
+        for (auto&& e : x)
+        {
+            e = ~e;
+        }
 
-            for (int j = 2; j <= 36; j++)
-            {
-                auto intStr = std::string(sizeof(intNum) * 8, 0);
+        add_1(x.data(), x.data(), x.size(), 1);
+    }
 
-                std::to_chars(intStr.data(), intStr.data() + intStr.size(), intNum, j);
+    inline auto toom_is_negative(const Nat& x) noexcept -> bool
+    {
+        return x.back() >> (LimbBits - 1) != 0;
+    }
 
-                intStr.resize(bigNum.ToStdString(j).size());
+    // x /= 2^shift for an x it divides, 0 < shift < LimbBits.
+    inline void toom_shr(Nat& x, std::size_t shift) noexcept
+    {
+        const auto isNegative = toom_is_negative(x);
 
-                std::ranges::for_each(intStr, [](auto&& e_)
-                                    {
-                                        e_ = static_cast<char>(std::toupper(e_));
-                                    });
+        rshift(x.data(), x.data(), x.size(), shift);
 
-                assert(bigNum == BigInt(intStr, j));
+        if (isNegative)
+        {
+            x.back() |= ~Limb(0) << (LimbBits - shift);
+        }
+    }
 
-                assert(intNum == bigNum.ToInteger<decltype(intNum)>());
+    // p(x) and p(-x) modulo B^w, from the even and the odd pieces by Horner's rule in x^2. Both parts stay
+    // non-negative and below B^(n + 2) for the points used here, so only the last step is as wide as w.
+    inline void toom_eval(Nat& plus, Nat& minus, const Limb* p, std::size_t size, std::size_t n, std::size_t pieces,
+                          Limb x, std::size_t w)
+    {
+        plus .assign(w, 0);
+        minus.assign(w, 0);
 
-                assert(intStr == bigNum.ToStdString(j));
+        for (auto i = pieces; i > 0; i--)
+        {
+            auto&& part = (i - 1) % 2 == 0 ? plus : minus;
 
-                switch (j)
-                {
-                    case 0B10:
-                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0B"));
-                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0b"));
-                        break;
-                    case 010:
-                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0"));
-                        break;
-                    case 0X10:
-                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0X"));
-                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0x"));
-                        break;
-                    default:
-                        break;
-                }
-            }
+            mul_1(part.data(), part.data(), n + 2, x * x);
 
-            assert((+bigNum) == (+intNum));
-            assert((-bigNum) == (-intNum));
-            assert((~bigNum) == (~intNum));
+            add(part.data(), part.data(), n + 2, p + (i - 1) * n, std::min(n, size - (i - 1) * n));
+        }
 
-            assert((bigNum - intNum) == 0);
-            assert((bigNum / intNum) == 1);
-            assert((bigNum % intNum) == 0);
-            assert((bigNum ^ intNum) == 0);
+        mul_1(minus.data(), minus.data(), n + 2, x);
 
-            assert(++bigNum == ++intNum);
-            assert(bigNum++ == intNum++);
+        auto&& odd = minus;
 
-            assert(--bigNum == --intNum);
-            assert(bigNum-- == intNum--);
+        auto even = plus;
 
-            for (int j = -1; j <= 1; j++)
-            {
-                assert((j + bigNum) == (j + intNum));
-                assert((j - bigNum) == (j - intNum));
-                assert((j * bigNum) == (j * intNum));
-                assert((j / bigNum) == (j / intNum));
-                assert((j % bigNum) == (j % intNum));
-                assert((j & bigNum) == (j & intNum));
-                assert((j | bigNum) == (j | intNum));
-                assert((j ^ bigNum) == (j ^ intNum));
+        add_n(plus .data(), even.data(), odd.data(), w);
+        sub_n(minus.data(), even.data(), odd.data(), w);
+    }
 
-                assert((bigNum + j) == (intNum + j));
-                assert((bigNum - j) == (intNum - j));
-                assert((bigNum * j) == (intNum * j));
-                assert((bigNum & j) == (intNum & j));
-                assert((bigNum | j) == (intNum | j));
-                assert((bigNum ^ j) == (intNum ^ j));
-            }
+    // r[i] is the product at the i-th of 0, 1, -1, 2, -2, ..., infinity.
+    inline auto toom_points(const Limb* ap, std::size_t an, std::size_t k, const Limb* bp, std::size_t bn, std::size_t l,
+                            std::size_t n, std::size_t w) -> std::vector<Nat>
+    {
+        auto ret = std::vector<Nat>(k + l - 1);
 
-            assert((bigNum + 2022 - intNum - 1997) == (intNum + 2022 - intNum - 1997));
-            assert((bigNum - 2022 + intNum + 1997) == (intNum - 2022 + intNum + 1997));
-            assert((bigNum - 1997 - intNum - 2022) == (intNum - 1997 - intNum - 2022));
-            assert((bigNum - 1997 + intNum + 2022) == (intNum - 1997 + intNum + 2022));
+        auto xs  = std::vector<Nat>(ret.size());
+        auto ys  = std::vector<Nat>(ret.size());
 
-            auto num1 = id(re);
-            auto num2 = id(re);
+        for (auto i = 1zu; i + 1 < ret.size(); i += 2)
+        {
+            toom_eval(xs[i], xs[i + 1], ap, an, n, k, static_cast<Limb>((i + 1) / 2), w);
+            toom_eval(ys[i], ys[i + 1], bp, bn, n, l, static_cast<Limb>((i + 1) / 2), w);
+        }
 
-            for (; num1 == 0;)
+        const auto product_ = [&](std::size_t i_)
+        {
+            auto&& r_ = ret[i_];
+
+            r_ = Nat(w);
+
+            if (i_ == 0)
             {
-                num1 = id(re);
+                mul(r_.data(), ap, n, bp, n);
             }
-
-            for (; num2 == 0;)
+            else if (i_ == ret.size() - 1)
             {
-                num2 = id(re);
+                mul(r_.data(), ap + (k - 1) * n, an - (k - 1) * n, bp + (l - 1) * n, bn - (l - 1) * n);
             }
+            else
+            {
+                auto&& x_ = xs[i_];
+                auto&& y_ = ys[i_];
 
-            // std::printf("num1: %6d, num2: %6d\n", num1, num2);
+                const auto isNegative_ = toom_is_negative(x_) != toom_is_negative(y_);
 
-            assert((BigInt(num1) +  num1) == (num1 +  num1));
-            assert((BigInt(num1) -  num1) == (num1 -  num1));
-            assert((BigInt(num1) *  num1) == (num1 *  num1));
-            assert((BigInt(num1) /  num1) == (num1 /  num1));
-            assert((BigInt(num1) %  num1) == (num1 %  num1));
-            assert((BigInt(num1) &  num1) == (num1 &  num1));
-            assert((BigInt(num1) |  num1) == (num1 |  num1));
-            assert((BigInt(num1) ^  num1) == (num1 ^  num1));
-            assert((BigInt(num1) == num1) == (num1 == num1));
-            assert((BigInt(num1) != num1) == (num1 != num1));
-            assert((BigInt(num1) <  num1) == (num1 <  num1));
-            assert((BigInt(num1) >= num1) == (num1 >= num1));
-            assert((BigInt(num1) >  num1) == (num1 >  num1));
-            assert((BigInt(num1) <= num1) == (num1 <= num1));
+                if (toom_is_negative(x_))
+                {
+                    toom_negate(x_);
+                }
 
-            assert((BigInt(num2) +  num2) == (num2 +  num2));
-            assert((BigInt(num2) -  num2) == (num2 -  num2));
-            assert((BigInt(num2) *  num2) == (num2 *  num2));
-            assert((BigInt(num2) /  num2) == (num2 /  num2));
-            assert((BigInt(num2) %  num2) == (num2 %  num2));
-            assert((BigInt(num2) &  num2) == (num2 &  num2));
-            assert((BigInt(num2) |  num2) == (num2 |  num2));
-            assert((BigInt(num2) ^  num2) == (num2 ^  num2));
-            assert((BigInt(num2) == num2) == (num2 == num2));
-            assert((BigInt(num2) != num2) == (num2 != num2));
+                if (toom_is_negative(y_))
+                {
+                    toom_negate(y_);
+                }
+
+                const auto xn_ = normalized_size(x_.data(), x_.size());
+                const auto yn_ = normalized_size(y_.data(), y_.size());
+
+                if (xn_ != 0 && yn_ != 0)
+                {
+                    mul(r_.data(), x_.data(), xn_, y_.data(), yn_);
+                }
+
+                if (isNegative_)
+                {
+                    toom_negate(r_);
+                }
+            }
+        };
+
+        const auto fork_ = [&](const auto& self_, std::size_t first_, std::size_t last_) -> void
+        {
+            if (last_ - first_ == 1)
+            {
+                product_(first_);
+
+                return;
+            }
+
+            const auto mid_ = first_ + (last_ - first_) / 2;
+
+            fork_join(an, [&] { self_(self_, first_, mid_); }, [&] { self_(self_, mid_, last_); });
+        };
+
+        fork_(fork_, 0, ret.size());
+
+        return ret;
+    }
+
+    // rp[0, size) = sum of c[i] B^(i n), the coefficients are the non-negative ones of the product.
+    inline void toom_combine(Limb* rp, std::size_t size, const std::vector<Nat>& c, std::size_t n) noexcept
+    {
+        std::fill(rp, rp + size, Limb(0));
+
+        for (auto i = 0zu; i < c.size(); i++)
+        {
+            add(rp + i * n, rp + i * n, size - i * n, c[i].data(), normalized_size(c[i].data(), c[i].size()));
+        }
+    }
+
+    // a = a2 X^2 + a1 X + a0 and b = b1 X + b0 at 0, 1, -1 and infinity, for a about 1.5 times as long as b.
+    // requires 0 < an - 2n <= n and 0 < bn - n <= n.
+    inline void mul_toom32(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn, std::size_t n)
+    {
+        const auto w = n * 2 + 2;
+
+        auto r = toom_points(ap, an, 3, bp, bn, 2, n, w);
+
+        auto&& [r0, r1, rm1, rinf] = std::tie(r[0], r[1], r[2], r[3]);
+
+        // c2 = (r(1) + r(-1)) / 2 - c0 and c1 = (r(1) - r(-1)) / 2 - c3, into r(-1) and r(1).
+        auto c2 = r1;
+
+        add_n(c2.data(), c2.data(), rm1.data(), w);
+        sub_n(r1.data(), r1.data(), rm1.data(), w);
+
+        toom_shr(c2, 1);
+        toom_shr(r1, 1);
+
+        sub_n(c2.data(), c2.data(), r0.data(),   w);
+        sub_n(r1.data(), r1.data(), rinf.data(), w);
+
+        rm1.swap(c2);
+
+        toom_combine(rp, an + bn, r, n);
+    }
+
+    // a = a3 X^3 + ... + a0 and b = b2 X^2 + b1 X + b0 at 0, 1, -1, 2, -2 and infinity, for a about 4/3 as long as b.
+    // requires 0 < an - 3n <= n and 0 < bn - 2n <= n.
+    inline void mul_toom43(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn, std::size_t n)
+    {
+        const auto w = n * 2 + 2;
+
+        auto r = toom_points(ap, an, 4, bp, bn, 3, n, w);
+
+        auto&& [r0, r1, rm1, r2, rm2, rinf] = std::tie(r[0], r[1], r[2], r[3], r[4], r[5]);
+
+        // the even part e(x) = c4 x^2 + c2 x + c0 and the odd part o(x) = c5 x^2 + c3 x + c1 of the product at x = 1 and 4:
+        // e(1) = (r(1) + r(-1)) / 2, o(1) = (r(1) - r(-1)) / 2, e(4) = (r(2) + r(-2)) / 2 and o(4) = (r(2) - r(-2)) / 4.
+        auto e1 = r1;
+        auto e4 = r2;
+
+        add_n(e1.data(), e1.data(), rm1.data(), w);
+        sub_n(r1.data(), r1.data(), rm1.data(), w);
+        add_n(e4.data(), e4.data(), rm2.data(), w);
+        sub_n(r2.data(), r2.data(), rm2.data(), w);
+
+        toom_shr(e1, 1);
+        toom_shr(r1, 1);
+        toom_shr(e4, 1);
+        toom_shr(r2, 2);
+
+        // c2 + c4 = e(1) - c0 and c2 + 4 c4 = (e(4) - c0) / 4, so c4 = (their difference) / 3.
+        sub_n(e1.data(), e1.data(), r0.data(), w);
+        sub_n(e4.data(), e4.data(), r0.data(), w);
+
+        toom_shr(e4, 2);
+
+        sub_n(e4.data(), e4.data(), e1.data(), w);
+
+        divexact_1(e4.data(), e4.data(), w, 3);
+
+        sub_n(e1.data(), e1.data(), e4.data(), w);
+
+        // c1 + c3 = o(1) - c5 and c1 + 4 c3 = o(4) - 16 c5, so c3 = (their difference) / 3.
+        auto c5x16 = rinf;
+
+        mul_1(c5x16.data(), c5x16.data(), w, 16);
+
+        sub_n(r1.data(), r1.data(), rinf.data(),  w);
+        sub_n(r2.data(), r2.data(), c5x16.data(), w);
+        sub_n(r2.data(), r2.data(), r1.data(),    w);
+
+        divexact_1(r2.data(), r2.data(), w, 3);
+
+        sub_n(r1.data(), r1.data(), r2.data(), w);
+
+        rm1.swap(e1);
+        rm2.swap(e4);
+
+        toom_combine(rp, an + bn, r, n);
+    }
+
+    // rp[0, an + bn) = ap[0, an) * bp[0, bn), rp must not overlap the operands. A single limb b is one pass of mul_1
+    // in the basecase, b at most half as long as a is multiplied piece by piece, and the unbalanced shapes between
+    // go to Toom-4/3 around 4/3 and Toom-3/2 around 3/2 once b reaches mulToom.
+    inline void mul(Limb* rp, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        if (an < bn)
+        {
+            std::swap(ap, bp);
+            std::swap(an, bn);
+        }
+
+        if (bn == 0)
+        {
+            std::fill(rp, rp + an, Limb(0));
+        }
+        else if (bn < std::max(thresholds().mulKaratsuba, 4zu))
+        {
+            U_AKR_BIGINT_COUNT_TIER(MulBasecase);
+
+            mul_basecase(rp, ap, an, bp, bn);
+        }
+        else if (bn <= (an + 1) / 2)
+        {
+            U_AKR_BIGINT_COUNT_TIER(MulChunked);
+
+            mul_chunked(rp, ap, an, bp, bn);
+        }
+        else if (bn >= std::max(thresholds().mulToom, 16zu) && an * 20 >= bn * 23 && an * 10 < bn * 14)
+        {
+            U_AKR_BIGINT_COUNT_TIER(MulToom43);
+
+            mul_toom43(rp, ap, an, bp, bn, 1 + (an * 3 >= bn * 4 ? (an - 1) / 4 : (bn - 1) / 3));
+        }
+        else if (bn >= std::max(thresholds().mulToom, 16zu) && an * 10 >= bn * 14)
+        {
+            U_AKR_BIGINT_COUNT_TIER(MulToom32);
+
+            mul_toom32(rp, ap, an, bp, bn, 1 + (an * 2 >= bn * 3 ? (an - 1) / 3 : (bn - 1) / 2));
+        }
+        else
+        {
+            U_AKR_BIGINT_COUNT_TIER(MulKaratsuba);
+
+            mul_karatsuba(rp, ap, an, bp, bn);
+        }
+    }
+
+    inline auto nat_mul(const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn) -> Nat
+    {
+        an = normalized_size(ap, an);
+        bn = normalized_size(bp, bn);
+
+        if (an == 0 || bn == 0)
+        {
+            return {};
+        }
+
+        auto ret = Nat(an + bn);
+
+        mul(ret.data(), ap, an, bp, bn);
+
+        nat_trim(ret);
+
+        return ret;
+    }
+
+    inline void div_qr_basecase(Nat& q, Nat& r, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        an = normalized_size(ap, an);
+
+        if (an < bn)
+        {
+            q.clear();
+            r.assign(ap, ap + an);
+
+            return;
+        }
+
+        U_AKR_BIGINT_COUNT_TIER(DivBasecase);
+
+        q.assign(an - bn + 1, 0);
+
+        if (bn == 1)
+        {
+            r.assign(1, divrem_1(q.data(), ap, an, bp[0]));
+        }
+        else
+        {
+            auto&& un = scratch().un;
+            auto&& vn = scratch().vn;
+
+            un.resize(an + 1);
+            vn.resize(bn);
+
+            r.assign(bn, 0);
+
+            divrem(q.data(), r.data(), ap, an, bp, bn, un.data(), vn.data());
+        }
+
+        nat_trim(q);
+        nat_trim(r);
+    }
+
+    // the recursive division of Burnikel and Ziegler as given in Modern Computer Arithmetic (algorithm 1.8),
+    // requires the top bit of bp[bn - 1] set and an <= 2 * bn.
+    inline void div_qr_recursive(Nat& q, Nat& r, const Limb* ap, std::size_t an, const Limb* bp, std::size_t bn)
+    {
+        an = normalized_size(ap, an);
+
+        if (an < bn + std::max(thresholds().divRecursive, 2zu))
+        {
+            div_qr_basecase(q, r, ap, an, bp, bn);
+
+            return;
+        }
+
+        U_AKR_BIGINT_COUNT_TIER(DivRecursive);
+
+        const auto k = (an - bn) / 2;
+
+        auto q1 = Nat();
+        auto r1 = Nat();
+
+        div_qr_recursive(q1, r1, ap + k * 2, an - k * 2, bp + k, bn - k);
+
+        auto u = Nat(ap, ap + k * 2);
+
+        u.insert(u.end(), r1.begin(), r1.end());
+
+        nat_trim(u);
+
+        auto t = nat_mul(q1.data(), q1.size(), bp, k);
+
+        for (; nat_cmp(u, t, k) < 0;)
+        {
+            sub_1(q1.data(), q1.data(), q1.size(), 1);
+
+            nat_add(u, bp, bn, k);
+        }
+
+        nat_sub(u, t.data(), t.size(), k);
+
+        u.resize(std::max(u.size(), k));
+
+        auto q0 = Nat();
+        auto r0 = Nat();
+
+        div_qr_recursive(q0, r0, u.data() + k, u.size() - k, bp + k, bn - k);
+
+        u.resize(k);
+
+        u.insert(u.end(), r0.begin(), r0.end());
+
+        nat_trim(u);
+
+        t = nat_mul(q0.data(), q0.size(), bp, k);
+
+        for (; nat_cmp(u, t) < 0;)
+        {
+            sub_1(q0.data(), q0.data(), q0.size(), 1);
+
+            nat_add(u, bp, bn);
+        }
+
+        nat_sub(u, t.data(), t.size());
+
+        nat_trim(q0);
+        nat_trim(q1);
+
+        nat_add(q0, q1.data(), q1.size(), k);
+
+        q.swap(q0);
+        r.swap(u);
+    }
+
+    // q = a / b and r = a % b for normalized magnitudes, b must not be zero.
+    inline void div_qr(Nat& q, Nat& r, const Nat& a, const Nat& b)
+    {
+        if (nat_cmp(a, b) < 0)
+        {
+            q.clear();
+            r = a;
+
+            return;
+        }
+
+        const auto divThreshold = std::max(thresholds().divRecursive, 2zu);
+
+        if (b.size() < divThreshold || a.size() - b.size() < divThreshold)
+        {
+            div_qr_basecase(q, r, a.data(), a.size(), b.data(), b.size());
+
+            return;
+        }
+
+        const auto shift = static_cast<std::size_t>(std::countl_zero(b.back()));
+
+        auto bn = b;
+        auto an = a;
+
+        if (shift > 0)
+        {
+            lshift(bn.data(), b.data(), b.size(), shift);
+
+            an.push_back(lshift(an.data(), a.data(), a.size(), shift));
+
+            nat_trim(an);
+        }
+
+        const auto n = bn.size();
+
+        auto qi = Nat();
+        auto ri = Nat();
+
+        q.clear();
+
+        for (; an.size() > n * 2;)
+        {
+            const auto h = an.size() - n * 2;
+
+            div_qr_recursive(qi, ri, an.data() + h, n * 2, bn.data(), n);
+
+            nat_add(q, qi.data(), qi.size(), h);
+
+            an.resize(h);
+
+            an.insert(an.end(), ri.begin(), ri.end());
+
+            nat_trim(an);
+        }
+
+        div_qr_recursive(qi, r, an.data(), an.size(), bn.data(), n);
+
+        nat_add(q, qi.data(), qi.size());
+
+        if (shift > 0 && !r.empty())
+        {
+            rshift(r.data(), r.data(), r.size(), shift);
+
+            nat_trim(r);
+        }
+    }
+
+    // a / b for normalized magnitudes when b is known to divide a, b must not be zero. The common power of two is
+    // shifted out of both so that b is odd, then the quotient is found from the low end. Having no remainder to fix
+    // up, this stays ahead of the recursive division until both sides have about four times its threshold.
+    inline auto nat_divexact(const Nat& a, const Nat& b) -> Nat
+    {
+        if (nat_cmp(a, b) < 0)
+        {
+            return {};
+        }
+
+        auto zeros = 0zu;
+
+        for (; b[zeros] == 0;)
+        {
+            zeros++;
+        }
+
+        const auto shift = static_cast<std::size_t>(std::countr_zero(b[zeros]));
+
+        auto bn = Nat(b.begin() + static_cast<std::ptrdiff_t>(zeros), b.end());
+        auto an = Nat(a.begin() + static_cast<std::ptrdiff_t>(zeros), a.end());
+
+        if (shift > 0)
+        {
+            rshift(bn.data(), bn.data(), bn.size(), shift);
+            rshift(an.data(), an.data(), an.size(), shift);
+
+            nat_trim(bn);
+            nat_trim(an);
+        }
+
+        if (an.size() < bn.size())
+        {
+            return {};
+        }
+
+        const auto qn = an.size() - bn.size() + 1;
+
+        if (const auto divThreshold = std::max(thresholds().divRecursive, 2zu); std::min(qn, bn.size()) >= divThreshold * 4)
+        {
+            auto q = Nat();
+            auto r = Nat();
+
+            div_qr(q, r, an, bn);
+
+            return q;
+        }
+
+        U_AKR_BIGINT_COUNT_TIER(DivHensel);
+
+        divexact(an.data(), an.data(), qn, bn.data(), bn.size());
+
+        an.resize(qn);
+
+        nat_trim(an);
+
+        return an;
+    }
+
+    inline auto nat_bit_length(const Nat& x) noexcept -> std::size_t
+    {
+        return x.empty() ? 0 : (x.size() - 1) * LimbBits + static_cast<std::size_t>(std::bit_width(x.back()));
+    }
+
+    // a modulus 2^k - c or 2^k + c with c below 2^32 and k of at least a limb, such as a Mersenne number or 2^255 - 19.
+    // x mod m takes no division: the bits of x from k up are multiplied by c and added to, or subtracted from, the
+    // bits below k, which shortens x by k - 32 bits or more each time, and a final correction brings it into [0, m).
+    struct SpecialForm final
+    {
+        std::size_t k;
+
+        Limb        c;
+
+        bool        isPlus;
+
+        // the form of a normalized m, if it has one. Moduli of one limb divide fast enough as they are.
+        static auto detect(const Nat& m) noexcept -> std::optional<SpecialForm>
+        {
+            constexpr auto cBound = Limb(1) << 32;
+
+            if (m.size() < 2)
+            {
+                return std::nullopt;
+            }
+
+            const auto bits = nat_bit_length(m);
+
+            const auto top  = bits % LimbBits == 0 ? ~Limb(0) : (Limb(1) << (bits % LimbBits)) - 1;
+
+            // 2^k - c: every bit but those of the low limb is set, and c = B - m[0].
+            if (m.back() == top && std::all_of(m.begin() + 1, m.end() - 1, [](Limb e_) { return e_ == ~Limb(0); }) && ~m[0] < cBound - 1)
+            {
+                return SpecialForm { bits, ~m[0] + 1, false };
+            }
+
+            // 2^k + c: the top bit and the low limb are all there is.
+            if (std::has_single_bit(m.back()) && std::all_of(m.begin() + 1, m.end() - 1, [](Limb e_) { return e_ == 0; }) && m[0] < cBound)
+            {
+                return SpecialForm { bits - 1, m[0], true };
+            }
+
+            return std::nullopt;
+        }
+
+        // x = x mod m for a normalized x, high is a buffer for the folded bits.
+        void reduce(Nat& x, Nat& high) const
+        {
+            const auto kl = k / LimbBits;
+            const auto kb = k % LimbBits;
+
+            auto isNegative = false;
+
+            for (; nat_bit_length(x) > k;)
+            {
+                const auto hn = x.size() - kl;
+
+                high.resize(hn + 1);
+
+                if (kb > 0)
+                {
+                    rshift(high.data(), x.data() + kl, hn, kb);
+                }
+                else
+                {
+                    std::copy(x.begin() + static_cast<std::ptrdiff_t>(kl), x.end(), high.begin());
+                }
+
+                high[hn] = mul_1(high.data(), high.data(), hn, c);
+
+                x.resize(kl + (kb > 0));
+
+                if (kb > 0)
+                {
+                    x.back() &= (Limb(1) << kb) - 1;
+                }
+
+                nat_trim(x);
+                nat_trim(high);
+
+                if (!isPlus)
+                {
+                    nat_add(x, high.data(), high.size());
+                }
+                else if (nat_cmp(x, high) >= 0)
+                {
+                    nat_sub(x, high.data(), high.size());
+                }
+                else
+                {
+                    nat_sub(high, x.data(), x.size());
+
+                    x.swap(high);
+
+                    isNegative = !isNegative;
+                }
+            }
+
+            // x < 2^k now, which for 2^k - c leaves at most one m to take off: x >= m when x + c reaches 2^k.
+            if (!isPlus)
+            {
+                nat_add(x, &c, 1);
+
+                if (nat_bit_length(x) > k)
+                {
+                    x[kl] &= ~(Limb(1) << kb);
+
+                    nat_trim(x);
+                }
+                else
+                {
+                    nat_sub(x, &c, 1);
+                }
+            }
+            else if (isNegative && !x.empty())
+            {
+                high.assign(kl + 1, 0);
+
+                high[kl] = Limb(1) << kb;
+
+                nat_sub(high, x.data(), x.size());
+                nat_add(high, &c, 1);
+
+                x.swap(high);
+            }
+        }
+    };
+
+    struct Radix final
+    {
+        int         base        = 10;
+
+        Limb        chunkBase   = 10;
+
+        std::size_t chunkDigits = 1;
+
+        std::vector<Nat> powers;
+
+        explicit Radix(int base_):
+            base(base_),
+            chunkBase(static_cast<Limb>(base_))
+        {
+            for (; chunkBase <= std::numeric_limits<Limb>::max() / static_cast<Limb>(base);)
+            {
+                chunkBase *= static_cast<Limb>(base);
+
+                chunkDigits++;
+            }
+
+            powers.push_back({ chunkBase });
+        }
+
+        // chunkBase^(2^level).
+        auto power(std::size_t level) -> const Nat&
+        {
+            for (; powers.size() <= level;)
+            {
+                powers.push_back(nat_mul(powers.back().data(), powers.back().size(), powers.back().data(), powers.back().size()));
+            }
+
+            return powers[level];
+        }
+    };
+
+    // writes exactly chunkDigits * 2^level digits of x < chunkBase^(2^level) that end at end.
+    inline void radix_write(char* end, Nat x, std::size_t level, const Radix& radix)
+    {
+        if (level == 0 || x.size() < std::max(thresholds().radixDivide, 1zu))
+        {
+            U_AKR_BIGINT_COUNT_TIER(RadixBasecase);
+
+            for (auto i = 0zu; i < (1zu << level); i++)
+            {
+                auto chunk = x.empty() ? Limb(0) : divrem_1(x.data(), x.data(), x.size(), radix.chunkBase);
+
+                nat_trim(x);
+
+                for (auto j = 0zu; j < radix.chunkDigits; j++)
+                {
+                    *--end = digit_to_char(static_cast<int>(chunk % static_cast<Limb>(radix.base)));
+
+                    chunk /= static_cast<Limb>(radix.base);
+                }
+            }
+
+            return;
+        }
+
+        U_AKR_BIGINT_COUNT_TIER(RadixDivide);
+
+        auto hi = Nat();
+        auto lo = Nat();
+
+        div_qr(hi, lo, x, radix.powers[level - 1]);
+
+        x = Nat();
+
+        const auto half = radix.chunkDigits << (level - 1);
+
+        fork_join(hi.size(), [&]
+                  {
+                      radix_write(end - half, std::move(hi), level - 1, radix);
+                  },
+                  [&]
+                  {
+                      radix_write(end, std::move(lo), level - 1, radix);
+                  });
+    }
+
+    // the digits of a normalized magnitude in base 2 to 36, without a sign.
+    inline auto to_radix_string(Nat x, int base) -> std::string
+    {
+        if (x.empty())
+        {
+            return "0";
+        }
+
+        if (std::has_single_bit(static_cast<unsigned>(base)))
+        {
+            const auto digitBits = static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(base)));
+
+            const auto bitLength = (x.size() - 1) * LimbBits + static_cast<std::size_t>(std::bit_width(x.back()));
+
+            auto ret = std::string((bitLength + digitBits - 1) / digitBits, '0');
+
+            for (auto i = 0zu; i < ret.size(); i++)
+            {
+                auto digit = 0;
+
+                for (auto j = 0zu; j < digitBits; j++)
+                {
+                    const auto bit = i * digitBits + j;
+
+                    if (bit < bitLength && ((x[bit / LimbBits] >> (bit % LimbBits)) & 1) != 0)
+                    {
+                        digit |= 1 << j;
+                    }
+                }
+
+                ret[ret.size() - 1 - i] = digit_to_char(digit);
+            }
+
+            return ret;
+        }
+
+        auto radix = Radix(base);
+
+        auto level = 0zu;
+
+        for (; nat_cmp(radix.power(level), x) <= 0;)
+        {
+            level++;
+        }
+
+        auto ret = std::string(radix.chunkDigits << level, '0');
+
+        radix_write(ret.data() + ret.size(), std::move(x), level, radix);
+
+        ret.erase(0, std::min(ret.find_first_not_of('0'), ret.size() - 1));
+
+        return ret;
+    }
+
+    inline auto radix_read(std::string_view digits, const Radix& radix) -> Nat
+    {
+        if (digits.size() <= std::max(thresholds().radixDivide, 1zu) * radix.chunkDigits)
+        {
+            U_AKR_BIGINT_COUNT_TIER(RadixBasecase);
+
+            auto ret = Nat();
+
+            const auto first = digits.size() % radix.chunkDigits;
+
+            for (auto i = 0zu; i < digits.size();)
+            {
+                const auto size = i == 0 && first != 0 ? first : radix.chunkDigits;
+
+                auto scale = Limb(1);
+                auto chunk = Limb(0);
+
+                for (auto j = 0zu; j < size; j++)
+                {
+                    scale *= static_cast<Limb>(radix.base);
+                    chunk  = chunk * static_cast<Limb>(radix.base) + static_cast<Limb>(char_to_digit(digits[i + j]));
+                }
+
+                if (const auto carry = mul_1(ret.data(), ret.data(), ret.size(), scale); carry != 0)
+                {
+                    ret.push_back(carry);
+                }
+
+                nat_add(ret, &chunk, 1);
+
+                i += size;
+            }
+
+            nat_trim(ret);
+
+            return ret;
+        }
+
+        auto level = 0zu;
+
+        for (; (radix.chunkDigits << (level + 1)) < digits.size();)
+        {
+            level++;
+        }
+
+        U_AKR_BIGINT_COUNT_TIER(RadixDivide);
+
+        const auto half = radix.chunkDigits << level;
+
+        auto hi = Nat();
+        auto lo = Nat();
+
+        fork_join(digits.size() / radix.chunkDigits, [&]
+                  {
+                      hi = radix_read(digits.substr(0, digits.size() - half), radix);
+                  },
+                  [&]
+                  {
+                      lo = radix_read(digits.substr(digits.size() - half), radix);
+                  });
+
+        auto ret = nat_mul(hi.data(), hi.size(), radix.powers[level].data(), radix.powers[level].size());
+
+        nat_add(ret, lo.data(), lo.size());
+
+        return ret;
+    }
+
+    // the magnitude of validated digits in base 2 to 36.
+    inline auto from_radix_string(std::string_view digits, int base) -> Nat
+    {
+        if (std::has_single_bit(static_cast<unsigned>(base)))
+        {
+            const auto digitBits = static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(base)));
+
+            auto ret = Nat((digits.size() * digitBits + LimbBits - 1) / LimbBits);
+
+            for (auto i = 0zu; i < digits.size(); i++)
+            {
+                const auto digit = static_cast<Limb>(char_to_digit(digits[digits.size() - 1 - i]));
+
+                for (auto j = 0zu; j < digitBits; j++)
+                {
+                    const auto bit = i * digitBits + j;
+
+                    ret[bit / LimbBits] |= ((digit >> j) & 1) << (bit % LimbBits);
+                }
+            }
+
+            nat_trim(ret);
+
+            return ret;
+        }
+
+        auto radix = Radix(base);
+
+        auto level = 0zu;
+
+        for (; (radix.chunkDigits << (level + 1)) < digits.size();)
+        {
+            level++;
+        }
+
+        radix.power(level);
+
+        return radix_read(digits, radix);
+    }
+
+    // collects streamed digits into fixed size text buffers and hands them to a sink, skipping leading zeros.
+    template<class F>
+    struct DigitWriter final
+    {
+        static constexpr auto BufferSize = 1zu << 14;
+
+        const F&    sink;
+
+        std::string buffer      = std::string();
+
+        bool        isLeading   = true;
+
+        explicit DigitWriter(const F& sink_):
+            sink(sink_)
+        {
+            buffer.reserve(BufferSize);
+        }
+
+        void put  (char c)
+        {
+            if (isLeading && c == '0')
+            {
+                return;
+            }
+
+            isLeading = false;
+
+            buffer.push_back(c);
+
+            if (buffer.size() == BufferSize)
+            {
+                flush();
+            }
+        }
+
+        void zeros(std::size_t count)
+        {
+            for (; !isLeading && count > 0; count--)
+            {
+                put('0');
+            }
+        }
+
+        void flush()
+        {
+            if (!buffer.empty())
+            {
+                sink(std::string_view(buffer));
+
+                buffer.clear();
+            }
+        }
+    };
+
+    // streams chunkDigits * 2^level digits of x < chunkBase^(2^level), most significant first.
+    // only the pending low halves are held, so the memory stays proportional to x.
+    template<class F>
+    void radix_stream(Nat x, std::size_t level, const Radix& radix, DigitWriter<F>& writer)
+    {
+        if (level == 0 || x.size() < std::max(thresholds().radixDivide, 1zu))
+        {
+            U_AKR_BIGINT_COUNT_TIER(RadixBasecase);
+
+            auto digits = std::string();
+
+            for (; !x.empty();)
+            {
+                auto chunk = divrem_1(x.data(), x.data(), x.size(), radix.chunkBase);
+
+                nat_trim(x);
+
+                for (auto j = 0zu; j < radix.chunkDigits; j++)
+                {
+                    digits.push_back(digit_to_char(static_cast<int>(chunk % static_cast<Limb>(radix.base))));
+
+                    chunk /= static_cast<Limb>(radix.base);
+                }
+            }
+
+            for (; !digits.empty() && digits.back() == '0';)
+            {
+                digits.pop_back();
+            }
+
+            writer.zeros((radix.chunkDigits << level) - digits.size());
+
+            for (auto i = digits.size(); i > 0; i--)
+            {
+                writer.put(digits[i - 1]);
+            }
+
+            return;
+        }
+
+        U_AKR_BIGINT_COUNT_TIER(RadixDivide);
+
+        auto hi = Nat();
+        auto lo = Nat();
+
+        div_qr(hi, lo, x, radix.powers[level - 1]);
+
+        x = Nat();
+
+        radix_stream(std::move(hi), level - 1, radix, writer);
+        radix_stream(std::move(lo), level - 1, radix, writer);
+    }
+
+    // hands the digits of a normalized magnitude to sink(std::string_view) piece by piece, without a sign.
+    template<class F>
+    void write_radix(Nat x, int base, const F& sink)
+    {
+        if (x.empty())
+        {
+            sink(std::string_view("0"));
+
+            return;
+        }
+
+        auto writer = DigitWriter<F>(sink);
+
+        if (std::has_single_bit(static_cast<unsigned>(base)))
+        {
+            const auto digitBits = static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(base)));
+
+            const auto bitLength = (x.size() - 1) * LimbBits + static_cast<std::size_t>(std::bit_width(x.back()));
+
+            for (auto i = (bitLength + digitBits - 1) / digitBits; i > 0; i--)
+            {
+                auto digit = 0;
+
+                for (auto j = 0zu; j < digitBits; j++)
+                {
+                    const auto bit = (i - 1) * digitBits + j;
+
+                    if (bit < bitLength && ((x[bit / LimbBits] >> (bit % LimbBits)) & 1) != 0)
+                    {
+                        digit |= 1 << j;
+                    }
+                }
+
+                writer.put(digit_to_char(digit));
+            }
+        }
+        else
+        {
+            auto radix = Radix(base);
+
+            auto level = 0zu;
+
+            for (; nat_cmp(radix.power(level), x) <= 0;)
+            {
+                level++;
+            }
+
+            radix_stream(std::move(x), level, radix, writer);
+        }
+
+        writer.flush();
+    }
+
+    // parses a number fed one character at a time, in the syntax of the BigInt string constructor.
+    // digits are converted in blocks merged like a binary counter, so only the magnitude is kept, never the text.
+    struct DigitReader final
+    {
+        private:
+        struct Block final
+        {
+            Nat         value;
+
+            std::size_t level;
+        };
+
+        private:
+        std::optional<int>  base;
+
+        std::optional<Radix> radix;
+
+        std::size_t         blockLevel  = 0;
+
+        std::string         digits;
+
+        std::vector<Block>  blocks;
+
+        bool                isNegative  = false;
+
+        bool                isZero      = false;
+
+        bool                hasDigits   = false;
+
+        public:
+        explicit DigitReader(std::optional<int> base_):
+            base(base_)
+        {
+            if (base.has_value() && !(2 <= base.value() && base.value() <= 36))
+            {
+                throw std::invalid_argument("base is invalid.");
+            }
+        }
+
+        void push(char c)
+        {
+            if (!radix.has_value())
+            {
+                if (!isZero && !hasDigits && (c == '+' || c == '-'))
+                {
+                    isNegative = isNegative || c == '-';
+
+                    return;
+                }
+
+                if (!base.has_value())
+                {
+                    if (!isZero && c == '0')
+                    {
+                        isZero = true;
+
+                        return;
+                    }
+
+                    if (isZero)
+                    {
+                        isZero = false;
+
+                        if (c == 'b' || c == 'B' || c == 'x' || c == 'X')
+                        {
+                            start(c == 'b' || c == 'B' ? 0B10 : 0X10);
+
+                            return;
+                        }
+
+                        start(010);
+                    }
+                    else
+                    {
+                        start(10);
+                    }
+                }
+                else
+                {
+                    start(base.value());
+                }
+            }
+
+            if (const auto digit = char_to_digit(c); !(0 <= digit && digit < radix->base))
+            {
+                throw std::invalid_argument("character is invalid.");
+            }
+
+            hasDigits = true;
+
+            digits.push_back(c);
+
+            if (digits.size() == radix->chunkDigits << blockLevel)
+            {
+                auto value = radix_read(digits, *radix);
+
+                digits.clear();
+
+                merge(std::move(value), blockLevel);
+            }
+        }
+
+        // whether no digit has been pushed yet, a lone "0" counts as one.
+        auto empty() const noexcept -> bool
+        {
+            return !hasDigits && !isZero;
+        }
+
+        auto finish() -> std::pair<Nat, bool>
+        {
+            if (isZero)
+            {
+                return { Nat(), false };
+            }
+
+            if (!hasDigits)
+            {
+                throw std::invalid_argument("character is invalid.");
+            }
+
+            auto ret = Nat();
+
+            for (auto&& e : blocks)
+            {
+                auto&& power = radix->power(e.level);
+
+                ret = nat_mul(ret.data(), ret.size(), power.data(), power.size());
+
+                nat_add(ret, e.value.data(), e.value.size());
+            }
+
+            if (!digits.empty())
+            {
+                const auto scale = radix_read(std::string(1, '1') + std::string(digits.size(), '0'), *radix);
+
+                ret = nat_mul(ret.data(), ret.size(), scale.data(), scale.size());
+
+                const auto rest = radix_read(digits, *radix);
+
+                nat_add(ret, rest.data(), rest.size());
+            }
+
+            nat_trim(ret);
+
+            if (ret.empty())
+            {
+                return { Nat(), false };
+            }
+
+            return { std::move(ret), isNegative };
+        }
+
+        private:
+        void start(int base_)
+        {
+            radix.emplace(base_);
+
+            blockLevel = static_cast<std::size_t>(std::bit_width(std::max(thresholds().radixDivide, 1zu)));
+
+            radix->power(blockLevel);
+        }
+
+        // adds a block of chunkDigits * 2^level digits below the ones read before.
+        void merge(Nat value, std::size_t level)
+        {
+            for (; !blocks.empty() && blocks.back().level == level; level++)
+            {
+                auto&& power = radix->power(level);
+
+                auto merged = nat_mul(blocks.back().value.data(), blocks.back().value.size(), power.data(), power.size());
+
+                nat_add(merged, value.data(), value.size());
+
+                nat_trim(merged);
+
+                value = std::move(merged);
+
+                blocks.pop_back();
+            }
+
+            blocks.push_back({ std::move(value), level });
+        }
+    };
+
+    // output iterator feeding the blocks of a bitset to a function, or-ing the sign extension into the top block.
+    template<class F>
+    struct LimbSink final
+    {
+        using iterator_category = std::output_iterator_tag;
+        using value_type        = void;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = void;
+
+        const F*    func;
+
+        std::size_t index;
+
+        std::size_t last;
+
+        Limb        fill;
+
+        auto operator* () noexcept -> LimbSink&
+        {
+            return *this;
+        }
+
+        auto operator++() noexcept -> LimbSink&
+        {
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> LimbSink
+        {
+            return *this;
+        }
+
+        auto operator= (Limb limb) -> LimbSink&
+        {
+            (*func)(index == last ? limb | fill : limb);
+
+            index++;
+
+            return *this;
+        }
+    };
+
+    // byte i of the two's complement number given by its low limbs and the fill of all the higher ones.
+    inline auto limb_byte(const Limb* limbs, std::size_t n, Limb fill, std::size_t i) noexcept -> std::byte
+    {
+        const auto limb = i / sizeof(Limb) < n ? limbs[i / sizeof(Limb)] : fill;
+
+        return static_cast<std::byte>(limb >> (i % sizeof(Limb) * 8));
+    }
+
+    // writes the low out.size() bytes of the number in the given order.
+    inline void store_bytes(std::span<std::byte> out, const Limb* limbs, std::size_t n, Limb fill, std::endian order) noexcept
+    {
+        if (order == std::endian::little && std::endian::native == std::endian::little)
+        {
+            const auto copied = std::min(out.size(), n * sizeof(Limb));
+
+            if (copied > 0)
+            {
+                std::memcpy(out.data(), limbs, copied);
+            }
+
+            std::fill(out.begin() + static_cast<std::ptrdiff_t>(copied), out.end(), static_cast<std::byte>(fill));
+
+            return;
+        }
+
+        for (auto i = 0zu; i < out.size(); i++)
+        {
+            out[order == std::endian::little ? i : out.size() - 1 - i] = limb_byte(limbs, n, fill, i);
+        }
+    }
+
+    // reads bytes in the given order into n limbs, the limbs past the bytes become fill.
+    inline void load_bytes(Limb* rp, std::size_t n, std::span<const std::byte> bytes, std::endian order, Limb fill) noexcept
+    {
+        std::fill(rp, rp + n, Limb(0));
+
+        if (order == std::endian::little && std::endian::native == std::endian::little)
+        {
+            if (const auto copied = std::min(bytes.size(), n * sizeof(Limb)); copied > 0)
+            {
+                std::memcpy(rp, bytes.data(), copied);
+            }
+        }
+        else
+        {
+            for (auto i = 0zu; i < bytes.size() && i / sizeof(Limb) < n; i++)
+            {
+                const auto byte = bytes[order == std::endian::little ? i : bytes.size() - 1 - i];
+
+                rp[i / sizeof(Limb)] |= static_cast<Limb>(byte) << (i % sizeof(Limb) * 8);
+            }
+        }
+
+        if (const auto rest = bytes.size() % sizeof(Limb); rest != 0 && bytes.size() / sizeof(Limb) < n)
+        {
+            rp[bytes.size() / sizeof(Limb)] |= fill << (rest * 8);
+        }
+
+        for (auto i = (bytes.size() + sizeof(Limb) - 1) / sizeof(Limb); i < n; i++)
+        {
+            rp[i] = fill;
+        }
+    }
+
+    // the prefixed format: a little endian 64-bit byte count, then that many little endian two's complement bytes.
+    inline constexpr auto PrefixBytes = 8zu;
+
+    // the payload of the first prefixed value in bytes, which is advanced past it.
+    inline auto take_prefixed(std::span<const std::byte>& bytes) -> std::span<const std::byte>
+    {
+        if (bytes.size() < PrefixBytes)
+        {
+            throw std::invalid_argument("bytes are truncated.");
+        }
+
+        auto size = std::uint64_t(0);
+
+        for (auto i = 0zu; i < PrefixBytes; i++)
+        {
+            size |= static_cast<std::uint64_t>(bytes[i]) << (i * 8);
+        }
+
+        if (size > bytes.size() - PrefixBytes)
+        {
+            throw std::invalid_argument("bytes are truncated.");
+        }
+
+        const auto payload = bytes.subspan(PrefixBytes, static_cast<std::size_t>(size));
+
+        bytes = bytes.subspan(PrefixBytes + payload.size());
+
+        return payload;
+    }
+}
+
+namespace akr
+{
+    struct BigInt;
+
+    namespace literals
+    {
+        template<char... C>
+        auto operator""_akr_bigint() -> const BigInt&;
+    }
+
+    namespace detail
+    {
+        struct BigIntAccess;
+    }
+
+    enum class OverflowMode;
+
+    template<std::size_t Bits, bool Signed, OverflowMode Mode>
+    struct FixedInt;
+
+    struct BigInt final
+    {
+        friend struct detail::BigIntAccess;
+
+        template<std::size_t Bits, bool Signed, OverflowMode Mode>
+        friend struct FixedInt;
+
+        template<char... C>
+        friend auto literals::operator""_akr_bigint() -> const BigInt&;
+
+        private:
+        using BitSet = boost::dynamic_bitset<std::size_t, detail::Allocator<std::size_t>>;
+
+        using Limb   = detail::Limb;
+
+        using Limbs  = detail::Nat;
+
+        private:
+        struct Trim final
+        {
+            private:
+            std::size_t count0 = 0;
+
+            std::size_t count1 = 0;
+
+            public:
+            Trim() = default;
+
+            public:
+            void Count(bool bit) noexcept
+            {
+                if (bit)
+                {
+                    count0 = 0;
+
+                    count1++;
+                }
+                else
+                {
+                    count1 = 0;
+
+                    count0++;
+                }
+            }
+
+            public:
+            void operator()(BigInt& bigInt) const
+            {
+                bigInt.binNumber.resize(bigInt.binNumber.size() - (!bigInt.isNegative ? count0 : count1));
+            }
+        };
+
+        private:
+        BitSet binNumber;
+
+        bool   isNegative = false;
+
+        public:
+        BigInt() = default;
+
+        template<std::integral T>
+        BigInt(T number):
+            BigInt(std::to_string(number))
+        {
+        }
+
+        template<std::size_t N>
+        BigInt(const char(&numChars)[N], std::optional<int> base = std::nullopt):
+            BigInt(std::string_view(numChars, N - 1), base)
+        {
+        }
+
+        template<class T>
+        requires(std::same_as<typename T::value_type, char>)
+        BigInt(const T& numStrContainer, std::optional<int> base = std::nullopt):
+            BigInt(std::string_view(numStrContainer.begin(), numStrContainer.end()), base)
+        {
+        }
+
+        // a copy of other whose storage comes from resource.
+        BigInt(const BigInt& other, std::pmr::memory_resource* resource):
+            isNegative(other.isNegative)
+        {
+            const auto guard = detail::ResourceGuard({ resource, false });
+
+            BitSet(other.binNumber).swap(binNumber);
+        }
+
+        private:
+        BigInt(std::string_view numStrView, std::optional<int> base = std::nullopt)
+        {
+            const auto parsed = detail::parse_prefix(numStrView, base);
+
+            fromMagnitude(detail::from_radix_string(parsed.digits, parsed.base), parsed.isNegative).swap(*this);
+
+            U_AKR_BIGINT_COUNT_OP(Parse, binNumber.size());
+        }
+
+        public:
+        auto operator+= (const BigInt& rhs) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Add, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (rhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (lhs.isZero())
+            {
+                return lhs = rhs;
+            }
+
+            auto needCarry = false;
+
+            if (lhs.isNegative == rhs.isNegative)
+            {
+                forEachBit(rhs, [&needCarry       ](bool lhs_, bool rhs_) noexcept
+                           {
+                               const auto newBit_ = lhs_ ^ rhs_ ^ needCarry;
+
+                               if (lhs_ == rhs_)
+                               {
+                                   needCarry = lhs_;
+                               }
+
+                               return newBit_;
+                           });
+
+                const bool newBit = lhs.isNegative ^ rhs.isNegative ^ needCarry;
+
+                if (newBit ^ lhs.isNegative)
+                {
+                    lhs.binNumber.push_back(newBit);
+                }
+            }
+            else
+            {
+                Trim trim;
+
+                forEachBit(rhs, [&needCarry, &trim](bool lhs_, bool rhs_) noexcept
+                           {
+                               const auto newBit_ = lhs_ ^ rhs_ ^ needCarry;
+
+                               if (lhs_ == rhs_)
+                               {
+                                   needCarry = lhs_;
+                               }
+
+                               trim.Count(newBit_);
+
+                               return newBit_;
+                           });
+
+                lhs.isNegative = lhs.isNegative ^ rhs.isNegative ^ needCarry;
+
+                trim(lhs);
+            }
+
+            return lhs;
+        }
+        auto operator-= (const BigInt& rhs) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Sub, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (rhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (lhs.isZero())
+            {
+                lhs = -rhs;
+
+                return lhs;
+            }
+
+            if (lhs == rhs)
+            {
+                lhs = BigInt("0");
+
+                return lhs;
+            }
+
+            return lhs += -rhs;
+        }
+        auto operator*= (const BigInt& rhs) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Mul, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (lhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (rhs.isZero())
+            {
+                lhs = BigInt("0");
+
+                return lhs;
+            }
+
+            const bool isLhsNegative = lhs.isNegative ^ rhs.isNegative;
+
+            const auto lhsMagnitude = lhs.toMagnitude();
+
+            const auto rhsMagnitude = rhs.toMagnitude();
+
+            auto magnitude = Limbs(lhsMagnitude.size() + rhsMagnitude.size());
+
+            detail::mul(magnitude.data(), lhsMagnitude.data(), lhsMagnitude.size(), rhsMagnitude.data(), rhsMagnitude.size());
+
+            lhs = fromMagnitude(std::move(magnitude), isLhsNegative);
+
+            return lhs;
+        }
+        auto operator/= (const BigInt& rhs) -> BigInt&
+        {
+            if (rhs.isZero())
+            {
+                throw std::invalid_argument("right operand is zero.");
+            }
+
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Div, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (lhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (lhs == rhs)
+            {
+                lhs = BigInt("1");
+
+                return lhs;
+            }
+
+            const bool isLhsNegative = lhs.isNegative ^ rhs.isNegative;
+
+            auto quotient  = Limbs();
+
+            auto remainder = Limbs();
+
+            detail::div_qr(quotient, remainder, lhs.toMagnitude(), rhs.toMagnitude());
+
+            lhs = fromMagnitude(std::move(quotient), isLhsNegative);
+
+            return lhs;
+        }
+        auto operator%= (const BigInt& rhs) -> BigInt&
+        {
+            if (rhs.isZero())
+            {
+                throw std::invalid_argument("right operand is zero.");
+            }
+
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Mod, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (lhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (lhs == rhs)
+            {
+                lhs = BigInt("0");
+
+                return lhs;
+            }
+
+            const bool isLhsNegative = lhs.isNegative;
+
+            auto magnitude = lhs.toMagnitude();
+
+            const auto divisor = rhs.toMagnitude();
+
+            // moduli like 2^p - 1 or 2^255 - 19 fold the high bits back onto the low ones instead of dividing.
+            if (const auto form = detail::SpecialForm::detect(divisor); form && magnitude.size() > divisor.size())
+            {
+                auto high = Limbs();
+
+                form->reduce(magnitude, high);
+
+                lhs = fromMagnitude(std::move(magnitude), isLhsNegative);
+
+                return lhs;
+            }
+
+            auto quotient  = Limbs();
+
+            auto remainder = Limbs();
+
+            detail::div_qr(quotient, remainder, magnitude, divisor);
+
+            lhs = fromMagnitude(std::move(remainder), isLhsNegative);
+
+            return lhs;
+        }
+
+        // *this /= rhs when rhs is known to divide *this, as after dividing by a gcd. Below the recursive division
+        // sizes it finds the quotient from the low limbs up and never forms a remainder, which is several times
+        // cheaper than /=. The result is unspecified if rhs does not divide *this.
+        auto divexact   (const BigInt& rhs) -> BigInt&
+        {
+            if (rhs.isZero())
+            {
+                throw std::invalid_argument("right operand is zero.");
+            }
+
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(DivExact, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (lhs.isZero())
+            {
+                return lhs;
+            }
+
+            const bool isLhsNegative = lhs.isNegative ^ rhs.isNegative;
+
+            lhs = fromMagnitude(detail::nat_divexact(lhs.toMagnitude(), rhs.toMagnitude()), isLhsNegative);
+
+            return lhs;
+        }
+
+        auto pow_assign (const BigInt& rhs) -> BigInt
+        {
+            if (rhs.isNegative)
+            {
+                throw std::invalid_argument("right operand is negative.");
+            }
+
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Pow, lhs.binNumber.size());
+
+            if (lhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (rhs.isZero())
+            {
+                lhs = BigInt("1");
+
+                return lhs;
+            }
+
+            auto tmp = std::move(lhs);
+
+            lhs = BigInt("1");
+
+            const auto rhsLength = rhs.binNumber.size();
+
+            for (auto i = 0zu; i < rhsLength; i++)
+            {
+                if (rhs.binNumber[i])
+                {
+                    lhs *= tmp;
+                }
+
+                tmp *= tmp;
+            }
+
+            return lhs;
+        }
+
+        auto operator&= (const BigInt& rhs) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(And, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (lhs.isZero() || rhs.isNOne())
+            {
+                return lhs;
+            }
+
+            if (rhs.isZero() || lhs.isNOne())
+            {
+                return lhs = rhs;
+            }
+
+            if (lhs == rhs)
+            {
+                return lhs;
+            }
+
+            return lhs.bitwiseOpr(rhs, [](auto&& lhs_, auto&& rhs_) noexcept
+                                  {
+                                      return lhs_ & rhs_;
+                                  });
+        }
+        auto operator|= (const BigInt& rhs) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Or, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (rhs.isZero() || lhs.isNOne())
+            {
+                return lhs;
+            }
+
+            if (lhs.isZero() || rhs.isNOne())
+            {
+                return lhs = rhs;
+            }
+
+            if (lhs == rhs)
+            {
+                return lhs;
+            }
+
+            return lhs.bitwiseOpr(rhs, [](auto&& lhs_, auto&& rhs_) noexcept
+                                  {
+                                      return lhs_ | rhs_;
+                                  });
+        }
+        auto operator^= (const BigInt& rhs) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Xor, std::max(lhs.binNumber.size(), rhs.binNumber.size()));
+
+            if (rhs.isZero())
+            {
+                return lhs;
+            }
+
+            if (rhs.isNOne())
+            {
+                return lhs.bitwiseNot();
+            }
+
+            if (lhs.isZero())
+            {
+                lhs = rhs;
+
+                return lhs;
+            }
+
+            if (lhs.isNOne())
+            {
+                lhs = rhs;
+
+                return lhs.bitwiseNot();
+            }
+
+            if (lhs == rhs)
+            {
+                lhs = BigInt("0");
+
+                return lhs;
+            }
+
+            return lhs.bitwiseOpr(rhs, [](auto&& lhs_, auto&& rhs_) noexcept
+                                  {
+                                      return lhs_ ^ rhs_;
+                                  });
+        }
+
+        auto operator<<=(std::size_t shift) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Shift, lhs.binNumber.size());
+
+            if (shift > 0)
+            {
+                lhs.binNumber.resize(lhs.binNumber.size() + shift);
+
+                lhs.binNumber <<= shift;
+            }
+
+            return lhs;
+        }
+        auto operator<<=(const BigInt& rhs) -> BigInt&
+        {
+            if (rhs.isNegative)
+            {
+                throw std::invalid_argument("right operand is negative.");
+            }
+
+            auto&& lhs = *this;
+
+            lhs <<= rhs.ToInteger<std::size_t>();
+
+            return lhs;
+        }
+
+        auto operator>>=(std::size_t shift) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            U_AKR_BIGINT_COUNT_OP(Shift, lhs.binNumber.size());
+
+            if (shift > 0)
+            {
+                if (lhs.binNumber.size() > shift)
+                {
+                    lhs.binNumber >>= shift;
+
+                    lhs.binNumber.resize(lhs.binNumber.size() - shift);
+                }
+                else
+                {
+                    binNumber.clear();
+                }
+            }
+
+            return lhs;
+        }
+        auto operator>>=(const BigInt& rhs) -> BigInt&
+        {
+            if (rhs.isNegative)
+            {
+                throw std::invalid_argument("right operand is negative.");
+            }
+
+            auto&& lhs = *this;
+
+            lhs >>= rhs.ToInteger<std::size_t>();
+
+            return lhs;
+        }
+
+        auto operator++ (   ) -> BigInt&
+        {
+            auto&& rhs = *this;
+
+            return rhs += 1;
+        }
+        auto operator++ (int) -> BigInt
+        {
+            auto&& lhs = *this;
+
+            BigInt tmp(lhs);
+
+            ++lhs;
+
+            return tmp;
+        }
+
+        auto operator-- (   ) -> BigInt&
+        {
+            auto&& rhs = *this;
+
+            return rhs -= 1;
+        }
+        auto operator-- (int) -> BigInt
+        {
+            auto&& lhs = *this;
+
+            BigInt tmp(lhs);
+
+            --lhs;
+
+            return tmp;
+        }
+
+        public:
+        friend auto operator+ (const BigInt& rhs) noexcept -> const BigInt&
+        {
+            return rhs;
+        }
+        friend auto operator- (const BigInt& rhs) -> BigInt
+        {
+            return BigInt(rhs).unaryMinus();
+        }
+        friend auto operator~ (const BigInt& rhs) -> BigInt
+        {
+            return BigInt(rhs).bitwiseNot();
+        }
+
+        friend auto operator+ (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
+                               {
+                                   return lhs_ += rhs_;
+                               });
+        }
+        friend auto operator- (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            if (rhs.isZero())
+            {
+                return  lhs;
+            }
+
+            if (lhs.isZero())
+            {
+                return -rhs;
+            }
+
+            if (lhs == rhs)
+            {
+                return BigInt("0");
+            }
+
+            return lhs + -rhs;
+        }
+        friend auto operator* (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
+                               {
+                                   return lhs_ *= rhs_;
+                               });
+        }
+        friend auto operator/ (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return BigInt(lhs) /= rhs;
+        }
+        friend auto operator% (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return BigInt(lhs) %= rhs;
+        }
+
+        friend auto operator& (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
+                               {
+                                   return lhs_ &= rhs_;
+                               });
+        }
+        friend auto operator| (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
+                               {
+                                   return lhs_ |= rhs_;
+                               });
+        }
+        friend auto operator^ (const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return bigOprSmall(lhs, rhs, [](auto&& lhs_, auto&& rhs_)
+                               {
+                                   return lhs_ ^= rhs_;
+                               });
+        }
+
+        friend auto operator<<(const BigInt& lhs, std::size_t shift) -> BigInt
+        {
+            return BigInt(lhs) <<=shift;
+        }
+        friend auto operator>>(const BigInt& lhs, std::size_t shift) -> BigInt
+        {
+            return BigInt(lhs) >>=shift;
+        }
+
+        friend auto operator<<(const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return BigInt(lhs) <<=rhs;
+        }
+        friend auto operator>>(const BigInt& lhs, const BigInt& rhs) -> BigInt
+        {
+            return BigInt(lhs) >>=rhs;
+        }
+
+        friend auto operator==(const BigInt& lhs, const BigInt& rhs) -> bool
+        {
+            if (lhs.isNegative != rhs.isNegative)
+            {
+                return false;
+            }
+
+            const auto lhsLength = lhs.binNumber.size();
+
+            const auto rhsLength = rhs.binNumber.size();
+
+            if (lhsLength != rhsLength)
+            {
+                return false;
+            }
+            else
+            {
+                return lhs.binNumber == rhs.binNumber;
+            }
+        }
+        friend auto operator!=(const BigInt& lhs, const BigInt& rhs) -> bool
+        {
+            return !(lhs == rhs);
+        }
+
+        friend auto operator< (const BigInt& lhs, const BigInt& rhs) -> bool
+        {
+            if (lhs.isNegative != rhs.isNegative)
+            {
+                return lhs.isNegative;
+            }
+
+            const auto lhsLength = lhs.binNumber.size();
+
+            const auto rhsLength = rhs.binNumber.size();
+
+            if (lhsLength != rhsLength)
+            {
+                return lhs.isNegative != (lhsLength < rhsLength);
+            }
+            else
+            {
+                return lhs.binNumber <  rhs.binNumber;
+            }
+        }
+        friend auto operator>=(const BigInt& lhs, const BigInt& rhs) -> bool
+        {
+            return !(lhs <  rhs);
+        }
+        friend auto operator> (const BigInt& lhs, const BigInt& rhs) -> bool
+        {
+            return   rhs <  lhs;
+        }
+        friend auto operator<=(const BigInt& lhs, const BigInt& rhs) -> bool
+        {
+            return !(rhs <  lhs);
+        }
+
+        // reads one whitespace delimited number a character at a time, the text is never held as a whole.
+        friend auto operator>>(std::istream& lhs,       BigInt& rhs) -> std::istream&
+        {
+            const auto sentry = std::istream::sentry(lhs);
+
+            if (!sentry)
+            {
+                return lhs;
+            }
+
+            auto reader = detail::DigitReader(std::nullopt);
+
+            for (auto c = lhs.peek(); c != std::istream::traits_type::eof() && !std::isspace(static_cast<char>(c), lhs.getloc()); c = lhs.peek())
+            {
+                reader.push(static_cast<char>(lhs.get()));
+            }
+
+            if (reader.empty())
+            {
+                lhs.setstate(std::ios_base::failbit);
+
+                return lhs;
+            }
+
+            auto [magnitude, isNegative] = reader.finish();
+
+            rhs = fromMagnitude(std::move(magnitude), isNegative);
+
+            return lhs;
+        }
+
+        // digits are written as they are produced, unless a field width asks for padding of the whole text.
+        friend auto operator<<(std::ostream& lhs, const BigInt& rhs) -> std::ostream&
+        {
+            if (lhs.width() != 0)
+            {
+                return lhs << rhs.ToStdString();
+            }
+
+            if (rhs.isNegative)
+            {
+                lhs.put('-');
+            }
+
+            detail::write_radix(rhs.toMagnitude(), 10, [&lhs](std::string_view digits_)
+                                {
+                                    lhs.write(digits_.data(), static_cast<std::streamsize>(digits_.size()));
+                                });
+
+            return lhs;
+        }
+
+        public:
+        void swap(BigInt& rhs) noexcept
+        {
+            auto&& lhs = *this;
+
+            auto lhsPair = std::tie(lhs.binNumber, lhs.isNegative);
+
+            auto rhsPair = std::tie(rhs.binNumber, rhs.isNegative);
+
+            lhsPair.swap(rhsPair);
+        }
+
+        public:
+        auto resource() const noexcept -> std::pmr::memory_resource*
+        {
+            return binNumber.get_allocator().resource;
+        }
+
+        public:
+        // the storage in bits, which assignments and the three-address functions reuse before they allocate.
+        auto capacity     () const noexcept -> std::size_t
+        {
+            return binNumber.capacity();
+        }
+
+        void reserve      (std::size_t bits)
+        {
+            binNumber.reserve(bits);
+        }
+
+        void shrink_to_fit()
+        {
+            binNumber.shrink_to_fit();
+        }
+
+        public:
+        // the bits of a value are its infinite two's complement: bits past bit_length() all equal the sign,
+        // the same bits the bitwise operators work on.
+
+        // the number of bits below the sign extension, 0 for 0 and -1.
+        auto bit_length   () const noexcept -> std::size_t
+        {
+            return binNumber.size();
+        }
+
+        // the number of bits that differ from the sign, the set bits of a non-negative value, the clear ones of a negative one.
+        auto popcount     () const noexcept -> std::size_t
+        {
+            auto count = 0zu;
+
+            const auto isNegative_ = isNegative;
+
+            const auto counter = [&count, isNegative_](Limb limb_)
+            {
+                count += static_cast<std::size_t>(std::popcount(isNegative_ ? ~limb_ : limb_));
+            };
+
+            boost::to_block_range(binNumber, detail::LimbSink<decltype(counter)> { &counter, 0, binNumber.num_blocks() - 1,
+                                  isNegative && binNumber.size() % detail::LimbBits != 0 ? ~Limb(0) << binNumber.size() % detail::LimbBits : Limb(0) });
+
+            return count;
+        }
+
+        // the index of the lowest set bit, std::numeric_limits<std::size_t>::max() for 0, which has none.
+        auto countr_zero  () const noexcept -> std::size_t
+        {
+            if (const auto index = binNumber.find_first(); index != BitSet::npos)
+            {
+                return index;
+            }
+
+            return isNegative ? binNumber.size() : std::numeric_limits<std::size_t>::max();
+        }
+
+        // the lowest set bit at index or above, std::numeric_limits<std::size_t>::max() if there is none.
+        auto next_set_bit (std::size_t index) const noexcept -> std::size_t
+        {
+            if (index < binNumber.size())
+            {
+                const auto next = index == 0 ? binNumber.find_first() : binNumber.find_next(index - 1);
+
+                if (next != BitSet::npos)
+                {
+                    return next;
+                }
+            }
+
+            return isNegative ? std::max(index, binNumber.size()) : std::numeric_limits<std::size_t>::max();
+        }
+
+        auto test_bit     (std::size_t index) const noexcept -> bool
+        {
+            return index < binNumber.size() ? binNumber[index] : isNegative;
+        }
+
+        auto set_bit      (std::size_t index) -> BigInt&
+        {
+            return assignBit(index, true);
+        }
+
+        auto clear_bit    (std::size_t index) -> BigInt&
+        {
+            return assignBit(index, false);
+        }
+
+        auto flip_bit     (std::size_t index) -> BigInt&
+        {
+            return assignBit(index, !test_bit(index));
+        }
+
+        public:
+        template<std::integral T>
+        auto ToInteger  () const -> T
+        {
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                if (isNegative)
+                {
+                    throw std::invalid_argument("unsigned integer is negative.");
+                }
+            }
+
+            const auto magnitude = toMagnitude();
+
+            constexpr auto Digits = static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits);
+
+            if (magnitude.size() * detail::LimbBits > Digits)
+            {
+                throw std::out_of_range("integer out of range.");
+            }
+
+            auto value = std::uintmax_t(0);
+
+            for (auto i = 0zu; i < magnitude.size(); i++)
+            {
+                value |= static_cast<std::uintmax_t>(magnitude[i]) << (i * detail::LimbBits);
+            }
+
+            if (value > static_cast<std::uintmax_t>(std::numeric_limits<T>::max()) + (isNegative ? 1 : 0))
+            {
+                throw std::out_of_range("integer out of range.");
+            }
+
+            return isNegative ? static_cast<T>(-static_cast<std::intmax_t>(value - 1) - 1) : static_cast<T>(value);
+        }
+
+        public:
+        auto ToBinString() const -> std::string
+        {
+            auto binString = std::string(binNumber.size(), '0');
+
+            boost::to_string(binNumber, binString);
+
+            return binString;
+        }
+
+        auto ToStdString(int base = 10) const -> std::string
+        {
+            if (!(2 <= base && base <= 36))
+            {
+                throw std::invalid_argument("base is invalid.");
+            }
+
+            U_AKR_BIGINT_COUNT_OP(Print, binNumber.size());
+
+            auto stdString = detail::to_radix_string(toMagnitude(), base);
+
+            if (isNegative)
+            {
+                stdString.insert(stdString.begin(), '-');
+            }
+
+            return stdString;
+        }
+
+        public:
+        // two's complement bytes of the value, or of its magnitude if unsigned, in as few bytes as possible.
+        auto to_bytes   (std::endian order = std::endian::little, bool isSigned = true) const -> std::vector<std::byte>
+        {
+            auto bytes = std::vector<std::byte>((binNumber.size() + (isSigned ? 8 : 7)) / 8);
+
+            to_bytes(bytes, order, isSigned);
+
+            return bytes;
+        }
+
+        // the same bytes, sign extended or zero padded to fill out exactly.
+        void to_bytes   (std::span<std::byte> out, std::endian order = std::endian::little, bool isSigned = true) const
+        {
+            if (!isSigned && isNegative)
+            {
+                throw std::invalid_argument("unsigned integer is negative.");
+            }
+
+            if (out.size() < (binNumber.size() + (isSigned ? 8 : 7)) / 8)
+            {
+                throw std::out_of_range("integer out of range.");
+            }
+
+            const auto limbs = toLimbs();
+
+            detail::store_bytes(out, limbs.data(), limbs.size(), isNegative ? ~Limb(0) : Limb(0), order);
+        }
+
+        static auto from_bytes(std::span<const std::byte> bytes, std::endian order = std::endian::little, bool isSigned = true) -> BigInt
+        {
+            const auto top = bytes.empty() ? std::byte(0) : bytes[order == std::endian::little ? bytes.size() - 1 : 0];
+
+            const auto isNegative = isSigned && (top & std::byte(0x80)) != std::byte(0);
+
+            auto limbs = Limbs((bytes.size() + sizeof(Limb) - 1) / sizeof(Limb));
+
+            detail::load_bytes(limbs.data(), limbs.size(), bytes, order, isNegative ? ~Limb(0) : Limb(0));
+
+            return fromLimbs(limbs, isNegative);
+        }
+
+        // a little endian 64-bit byte count followed by the signed little endian bytes padded to whole 64-bit words,
+        // so on little endian machines the payload is a plain copy of the limbs.
+        auto to_prefixed_bytes() const -> std::vector<std::byte>
+        {
+            const auto size = (binNumber.size() + 64) / 64 * 8;
+
+            auto bytes = std::vector<std::byte>(detail::PrefixBytes + size);
+
+            for (auto i = 0zu; i < detail::PrefixBytes; i++)
+            {
+                bytes[i] = static_cast<std::byte>(static_cast<std::uint64_t>(size) >> (i * 8));
+            }
+
+            to_bytes(std::span(bytes).subspan(detail::PrefixBytes), std::endian::little, true);
+
+            return bytes;
+        }
+
+        // reads the value written by to_prefixed_bytes at the front of bytes and advances bytes past it.
+        static auto from_prefixed_bytes(std::span<const std::byte>& bytes) -> BigInt
+        {
+            return from_bytes(detail::take_prefixed(bytes), std::endian::little, true);
+        }
+
+        private:
+        auto assignBit  (std::size_t index, bool bit) -> BigInt&
+        {
+            auto&& rhs = *this;
+
+            if (index >= rhs.binNumber.size())
+            {
+                if (bit == rhs.isNegative)
+                {
+                    return rhs;
+                }
+
+                rhs.binNumber.resize(index + 1, rhs.isNegative);
+            }
+
+            rhs.binNumber[index] = bit;
+
+            for (; !rhs.binNumber.empty() && rhs.binNumber[rhs.binNumber.size() - 1] == rhs.isNegative;)
+            {
+                rhs.binNumber.pop_back();
+            }
+
+            return rhs;
+        }
+
+        auto bitwiseNot () -> BigInt&
+        {
+            auto&& rhs = *this;
+
+            rhs.isNegative = !rhs.isNegative;
+
+            rhs.binNumber.flip();
+
+            return rhs;
+        }
+
+        template<class F>
+        auto bitwiseOpr (const BigInt& rhs, const F& func) -> BigInt&
+        {
+            auto&& lhs = *this;
+
+            Trim trim;
+
+            forEachBit(rhs, [&func, &trim](bool lhs_, bool rhs_) noexcept
+                       {
+                           const auto newBit_ = func(lhs_, rhs_);
+
+                           trim.Count(newBit_);
+
+                           return newBit_;
+                       });
+
+            lhs.isNegative = func(lhs.isNegative, rhs.isNegative);
+
+            if (lhs.isNegative)
+            {
+                lhs.binNumber.push_back(lhs.isNegative);
+
+                trim.Count(lhs.isNegative);
+            }
+
+            trim(lhs);
+
+            return lhs;
+        }
+
+        template<class F>
+        void forEachBit (const BigInt& rhs, const F& func)
+        {
+            auto&& lhs = *this;
+
+            const auto lhsLength = lhs.binNumber.size();
+
+            const auto rhsLength = rhs.binNumber.size();
+
+            const auto minLength = std::min(lhsLength, rhsLength);
+
+            auto i = 0zu;
+
+            for (; i < minLength; i++)
+            {
+                lhs.binNumber[i] = func(lhs.binNumber[i], rhs.binNumber[i]);
+            }
+
+            if (lhsLength >= rhsLength)
+            {
+                for (; i < lhsLength; i++)
+                {
+                    lhs.binNumber[i] = func(lhs.binNumber[i], rhs.isNegative);
+                }
+            }
+            else
+            {
+                lhs.binNumber.resize(rhsLength);
+
+                for (; i < rhsLength; i++)
+                {
+                    lhs.binNumber[i] = func(rhs.binNumber[i], lhs.isNegative);
+                }
+            }
+        }
+
+        auto unaryMinus () -> BigInt&
+        {
+            static const auto twosComplement = [](auto&& bigInt_)
+            {
+                bigInt_.binNumber.flip();
+
+                const auto size_ = bigInt_.binNumber.size();
+
+                for (auto i_ = 0zu; i_ < size_; i_++)
+                {
+                    bigInt_.binNumber[i_].flip();
+
+                    if (bigInt_.binNumber[i_] == 1)
+                    {
+                        break;
+                    }
+                }
+
+                if (!bigInt_.isNegative)
+                {
+                    if (bigInt_.binNumber[size_ - 1] == 0)
+                    {
+                        bigInt_.binNumber.resize(size_ + 1, 1);
+                    }
+                }
+                else
+                {
+                    if (bigInt_.binNumber[size_ - 1] == 1)
+                    {
+                        bigInt_.binNumber.resize(size_ - 1, 0);
+                    }
+                }
+            };
+
+            auto&& rhs = *this;
+
+            if (rhs.isZero())
+            {
+                return rhs;
+            }
+
+            if (rhs.isNOne())
+            {
+                rhs = BigInt("1");
+
+                return rhs;
+            }
+
+            rhs.isNegative = !rhs.isNegative;
+
+            twosComplement(rhs);
+
+            return rhs;
+        }
+
+        private:
+        // two's complement limbs of the value, the top limb is sign extended.
+        auto toLimbs    () const -> Limbs
+        {
+            auto limbs = Limbs();
+
+            limbs.reserve(binNumber.num_blocks());
+
+            boost::to_block_range(binNumber, std::back_inserter(limbs));
+
+            if (const auto rest = binNumber.size() % detail::LimbBits; isNegative && rest != 0)
+            {
+                limbs.back() |= ~Limb(0) << rest;
+            }
+
+            return limbs;
+        }
+
+        // the value whose low limbs are given in two's complement and whose higher limbs are all sign bits.
+        static auto fromLimbs  (std::span<const Limb> limbs, bool isNegative) -> BigInt
+        {
+            const auto fill = isNegative ? ~Limb(0) : Limb(0);
+
+            auto size = limbs.size();
+
+            for (; size > 0 && limbs[size - 1] == fill;)
+            {
+                size--;
+            }
+
+            BigInt ret;
+
+            ret.isNegative = isNegative;
+
+            if (size > 0)
+            {
+                ret.binNumber.append(limbs.begin(), limbs.begin() + static_cast<std::ptrdiff_t>(size));
+
+                ret.binNumber.resize((size - 1) * detail::LimbBits + std::bit_width(limbs[size - 1] ^ fill));
+            }
+
+            return ret;
+        }
+
+        // the two's complement limbs of the value sign extended to n limbs, into limbs and its storage, n must hold them all.
+        void limbsInto  (Limbs& limbs, std::size_t n) const
+        {
+            limbs.clear();
+
+            boost::to_block_range(binNumber, std::back_inserter(limbs));
+
+            const auto fill = isNegative ? ~Limb(0) : Limb(0);
+
+            if (const auto rest = binNumber.size() % detail::LimbBits; isNegative && rest != 0)
+            {
+                limbs.back() |= fill << rest;
+            }
+
+            limbs.resize(n, fill);
+        }
+
+        // the magnitude, normalized, into limbs and its storage.
+        void magnitudeInto(Limbs& limbs) const
+        {
+            limbsInto(limbs, binNumber.num_blocks() + 1);
+
+            if (isNegative)
+            {
+                for (auto&& e : limbs)
+                {
+                    e = ~e;
+                }
+
+                detail::add_1(limbs.data(), limbs.data(), limbs.size(), 1);
+            }
+
+            detail::nat_trim(limbs);
+        }
+
+        // fromLimbs into the storage of this value.
+        void assignLimbs(std::span<const Limb> limbs, bool isNegative_)
+        {
+            const auto fill = isNegative_ ? ~Limb(0) : Limb(0);
+
+            auto size = limbs.size();
+
+            for (; size > 0 && limbs[size - 1] == fill;)
+            {
+                size--;
+            }
+
+            isNegative = isNegative_;
+
+            binNumber.clear();
+
+            if (size > 0)
+            {
+                binNumber.append(limbs.begin(), limbs.begin() + static_cast<std::ptrdiff_t>(size));
+
+                binNumber.resize((size - 1) * detail::LimbBits + std::bit_width(limbs[size - 1] ^ fill));
+            }
+        }
+
+        // fromMagnitude into the storage of this value, magnitude is negated in place.
+        void assignMagnitude(Limbs& magnitude, bool isNegative_)
+        {
+            detail::nat_trim(magnitude);
+
+            if (magnitude.empty() || !isNegative_)
+            {
+                assignLimbs(magnitude, false);
+
+                return;
+            }
+
+            for (auto&& e : magnitude)
+            {
+                e = ~e;
+            }
+
+            detail::add_1(magnitude.data(), magnitude.data(), magnitude.size(), 1);
+
+            assignLimbs(magnitude, true);
+        }
+
+        auto toMagnitude() const -> Limbs
+        {
+            auto limbs = toLimbs();
+
+            if (isNegative)
+            {
+                for (auto&& e : limbs)
+                {
+                    e = ~e;
+                }
+
+                if (detail::add_1(limbs.data(), limbs.data(), limbs.size(), 1) != 0)
+                {
+                    limbs.push_back(1);
+                }
+            }
+
+            limbs.resize(detail::normalized_size(limbs.data(), limbs.size()));
+
+            return limbs;
+        }
+
+        static auto fromMagnitude(Limbs magnitude, bool isNegative) -> BigInt
+        {
+            magnitude.resize(detail::normalized_size(magnitude.data(), magnitude.size()));
+
+            if (magnitude.empty() || !isNegative)
+            {
+                return fromLimbs(magnitude, false);
+            }
+
+            for (auto&& e : magnitude)
+            {
+                e = ~e;
+            }
+
+            detail::add_1(magnitude.data(), magnitude.data(), magnitude.size(), 1);
+
+            return fromLimbs(magnitude, true);
+        }
+
+        private:
+        auto isNOne     () const noexcept -> bool
+        {
+            return binNumber.empty() &&  isNegative;
+        }
+
+        auto isZero     () const noexcept -> bool
+        {
+            return binNumber.empty() && !isNegative;
+        }
+
+        private:
+        template<class F>
+        static auto bigOprSmall(const BigInt& lhs, const BigInt& rhs, const F& func) -> BigInt
+        {
+            if (lhs.binNumber.size() >= rhs.binNumber.size())
+            {
+                return func(BigInt(lhs), rhs);
+            }
+            else
+            {
+                return func(BigInt(rhs), lhs);
+            }
+        }
+    };
+
+    namespace detail
+    {
+        // the limb level view of BigInt used by the free functions.
+        struct BigIntAccess final
+        {
+            static auto magnitude    (const BigInt& value) -> Nat
+            {
+                return value.toMagnitude();
+            }
+
+            static auto isNegative   (const BigInt& value) noexcept -> bool
+            {
+                return value.isNegative;
+            }
+
+            static auto fromMagnitude(Nat magnitude, bool isNegative) -> BigInt
+            {
+                return BigInt::fromMagnitude(std::move(magnitude), isNegative);
+            }
+
+            static auto fromLimbs    (std::span<const Limb> limbs, bool isNegative) -> BigInt
+            {
+                return BigInt::fromLimbs(limbs, isNegative);
+            }
+
+            static auto limbCount    (const BigInt& value) noexcept -> std::size_t
+            {
+                return value.binNumber.num_blocks();
+            }
+
+            static void limbsInto    (const BigInt& value, Nat& limbs, std::size_t n)
+            {
+                value.limbsInto(limbs, n);
+            }
+
+            static void magnitudeInto(const BigInt& value, Nat& limbs)
+            {
+                value.magnitudeInto(limbs);
+            }
+
+            static void assignLimbs  (BigInt& value, std::span<const Limb> limbs, bool isNegative)
+            {
+                value.assignLimbs(limbs, isNegative);
+            }
+
+            static void assignMagnitude(BigInt& value, Nat& magnitude, bool isNegative)
+            {
+                value.assignMagnitude(magnitude, isNegative);
+            }
+
+            // calls func with every two's complement limb of the value without copying them out first.
+            template<class F>
+            static void forEachLimb  (const BigInt& value, const F& func)
+            {
+                const auto rest = value.binNumber.size() % LimbBits;
+
+                const auto fill = value.isNegative && rest != 0 ? ~Limb(0) << rest : Limb(0);
+
+                boost::to_block_range(value.binNumber, LimbSink<F> { &func, 0, value.binNumber.num_blocks() - 1, fill });
+            }
+        };
+
+        // the primes not greater than n.
+        inline auto sieve_primes(std::size_t n) -> std::vector<Limb>
+        {
+            auto ret = std::vector<Limb>();
+
+            if (n < 2)
+            {
+                return ret;
+            }
+
+            ret.push_back(2);
+
+            auto isComposite = std::vector<bool>(n / 2 + 1);
+
+            for (auto i = 3zu; i <= n; i += 2)
+            {
+                if (isComposite[i / 2])
+                {
+                    continue;
+                }
+
+                ret.push_back(i);
+
+                for (auto j = i * i; j <= n; j += i * 2)
+                {
+                    isComposite[j / 2] = true;
+                }
+            }
+
+            return ret;
+        }
+
+        inline auto nat_product(std::span<const Nat> values) -> Nat
+        {
+            if (values.empty())
+            {
+                return { 1 };
+            }
+
+            if (values.size() == 1)
+            {
+                return values.front();
+            }
+
+            const auto half = values.size() / 2;
+
+            auto lhs = Nat();
+            auto rhs = Nat();
+
+            fork_join(values.size(), [&]
+                      {
+                          lhs = nat_product(values.first(half));
+                      },
+                      [&]
+                      {
+                          rhs = nat_product(values.subspan(half));
+                      });
+
+            return nat_mul(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+        }
+
+        // packs the factors into as few limbs as possible and multiplies those as a balanced tree.
+        inline auto limb_product(std::span<const Limb> factors) -> Nat
+        {
+            auto packed = std::vector<Nat>();
+
+            auto acc = Limb(1);
+
+            for (auto&& e : factors)
+            {
+                auto hi = Limb(0);
+
+                const auto lo = mul_wide(acc, e, hi);
+
+                if (hi != 0)
+                {
+                    packed.push_back({ acc });
+
+                    acc = e;
+                }
+                else
+                {
+                    acc = lo;
+                }
+            }
+
+            packed.push_back({ acc });
+
+            return nat_product(packed);
+        }
+
+        // the odd part of the prime swing n! / (n / 2)!^2.
+        inline auto odd_swing(std::size_t n, std::span<const Limb> primes) -> Nat
+        {
+            auto factors = std::vector<Limb>();
+
+            for (auto&& p : primes)
+            {
+                if (p > n)
+                {
+                    break;
+                }
+
+                if (p == 2)
+                {
+                    continue;
+                }
+
+                auto e = 0zu;
+
+                for (auto q = n / p; q > 0; q /= p)
+                {
+                    e += q & 1;
+                }
+
+                factors.insert(factors.end(), e, p);
+            }
+
+            return limb_product(factors);
+        }
+
+        // the odd part of n!, which is the odd part of (n / 2)!^2 times the odd part of the swing.
+        inline auto odd_factorial(std::size_t n, std::span<const Limb> primes) -> Nat
+        {
+            if (n < 2)
+            {
+                return { 1 };
+            }
+
+            auto lhs = Nat();
+            auto rhs = Nat();
+
+            fork_join(n / LimbBits, [&]
+                      {
+                          lhs = odd_factorial(n / 2, primes);
+
+                          lhs = nat_mul(lhs.data(), lhs.size(), lhs.data(), lhs.size());
+                      },
+                      [&]
+                      {
+                          rhs = odd_swing(n, primes);
+                      });
+
+            return nat_mul(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+        }
+    }
+
+    // a value serialized by to_bytes or to_prefixed_bytes, read in place from a buffer it does not own.
+    struct BigIntView final
+    {
+        private:
+        using Limb = detail::Limb;
+
+        private:
+        std::span<const std::byte> bytes;
+
+        std::endian                order    = std::endian::little;
+
+        bool                       isSigned = true;
+
+        public:
+        BigIntView() = default;
+
+        BigIntView(std::span<const std::byte> bytes, std::endian order = std::endian::little, bool isSigned = true) noexcept:
+            bytes(bytes),
+            order(order),
+            isSigned(isSigned)
+        {
+        }
+
+        // the view of the prefixed value at the front of bytes, which is advanced past it.
+        static auto from_prefixed_bytes(std::span<const std::byte>& bytes) -> BigIntView
+        {
+            return BigIntView(detail::take_prefixed(bytes));
+        }
+
+        public:
+        auto byte_size  () const noexcept -> std::size_t
+        {
+            return bytes.size();
+        }
+
+        auto limb_count () const noexcept -> std::size_t
+        {
+            return (bytes.size() + sizeof(Limb) - 1) / sizeof(Limb);
+        }
+
+        auto is_negative() const noexcept -> bool
+        {
+            return isSigned && !bytes.empty() && (byte(bytes.size() - 1) & std::byte(0x80)) != std::byte(0);
+        }
+
+        // limb i of the two's complement value, sign extended past the end of the buffer.
+        auto limb       (std::size_t i) const noexcept -> Limb
+        {
+            const auto fill = is_negative() ? ~Limb(0) : Limb(0);
+
+            if (i >= limb_count())
+            {
+                return fill;
+            }
+
+            if (order == std::endian::little && std::endian::native == std::endian::little && (i + 1) * sizeof(Limb) <= bytes.size())
+            {
+                auto ret = Limb(0);
+
+                std::memcpy(&ret, bytes.data() + i * sizeof(Limb), sizeof(Limb));
+
+                return ret;
+            }
+
+            auto ret = Limb(0);
+
+            for (auto j = 0zu; j < sizeof(Limb); j++)
+            {
+                const auto index = i * sizeof(Limb) + j;
+
+                ret |= static_cast<Limb>(index < bytes.size() ? byte(index) : static_cast<std::byte>(fill)) << (j * 8);
+            }
+
+            return ret;
+        }
+
+        // the buffer itself as limbs when it is little endian, limb aligned and made of whole limbs, without copying.
+        auto limbs      () const noexcept -> std::optional<std::span<const Limb>>
+        {
+            if (order != std::endian::little || std::endian::native != std::endian::little ||
+                bytes.size() % sizeof(Limb) != 0 || reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(Limb) != 0)
+            {
+                return std::nullopt;
+            }
+
+            return std::span(reinterpret_cast<const Limb*>(bytes.data()), bytes.size() / sizeof(Limb));
+        }
+
+        auto ToBigInt   () const -> BigInt
+        {
+            return BigInt::from_bytes(bytes, order, isSigned);
+        }
+
+        explicit operator BigInt() const
+        {
+            return ToBigInt();
+        }
+
+        public:
+        friend auto operator== (const BigIntView& lhs, const BigIntView& rhs) noexcept -> bool
+        {
+            return compare(lhs, rhs) == 0;
+        }
+
+        friend auto operator<=>(const BigIntView& lhs, const BigIntView& rhs) noexcept -> std::strong_ordering
+        {
+            return compare(lhs, rhs);
+        }
+
+        friend auto operator== (const BigIntView& lhs, const BigInt&     rhs) -> bool
+        {
+            const auto rhsBytes = rhs.to_bytes();
+
+            return compare(lhs, BigIntView(rhsBytes)) == 0;
+        }
+
+        friend auto operator<=>(const BigIntView& lhs, const BigInt&     rhs) -> std::strong_ordering
+        {
+            const auto rhsBytes = rhs.to_bytes();
+
+            return compare(lhs, BigIntView(rhsBytes));
+        }
+
+        private:
+        // byte i counted from the least significant one.
+        auto byte       (std::size_t i) const noexcept -> std::byte
+        {
+            return bytes[order == std::endian::little ? i : bytes.size() - 1 - i];
+        }
+
+        static auto compare(const BigIntView& lhs, const BigIntView& rhs) noexcept -> std::strong_ordering
+        {
+            if (lhs.is_negative() != rhs.is_negative())
+            {
+                return lhs.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+
+            for (auto i = std::max(lhs.limb_count(), rhs.limb_count()); i > 0; i--)
+            {
+                if (const auto ret = lhs.limb(i - 1) <=> rhs.limb(i - 1); ret != 0)
+                {
+                    return ret;
+                }
+            }
+
+            return std::strong_ordering::equal;
+        }
+    };
+
+    namespace detail
+    {
+        // calls func(i) for i in [first, last), splitting the range across the task pool when the work is large enough.
+        template<class F>
+        void parallel_for(std::size_t first, std::size_t last, std::size_t itemSize, const F& func)
+        {
+            if (auto&& pool = task_pool(); pool && last - first > 1 && (last - first) * itemSize >= thresholds().parallel)
+            {
+                const auto mid = first + (last - first) / 2;
+
+                pool->fork_join([&] { parallel_for(first, mid, itemSize, func); },
+                                [&] { parallel_for(mid,  last, itemSize, func); });
+            }
+            else
+            {
+                for (auto i = first; i < last; i++)
+                {
+                    func(i);
+                }
+            }
+        }
+
+        inline auto average_limbs(std::span<const BigInt> values) noexcept -> std::size_t
+        {
+            auto total = 0zu;
+
+            for (auto&& e : values)
+            {
+                total += BigIntAccess::limbCount(e);
+            }
+
+            return values.empty() ? 1 : std::max(total / values.size(), 1zu);
+        }
+
+        struct PartialSum final
+        {
+            Nat positive;
+
+            Nat negative;
+        };
+
+        // sums the values into two accumulators wide enough to never overflow, so no value is copied or resized.
+        inline auto partial_sum(std::span<const BigInt> values, std::size_t width, std::size_t itemSize) -> PartialSum
+        {
+            if (auto&& pool = task_pool(); pool && values.size() > 1 && values.size() * itemSize >= thresholds().parallel)
+            {
+                const auto half = values.size() / 2;
+
+                auto lhs = PartialSum {};
+                auto rhs = PartialSum {};
+
+                pool->fork_join([&] { lhs = partial_sum(values.first(half), width, itemSize); },
+                                [&] { rhs = partial_sum(values.subspan(half), width, itemSize); });
+
+                add_n(lhs.positive.data(), lhs.positive.data(), rhs.positive.data(), width);
+                add_n(lhs.negative.data(), lhs.negative.data(), rhs.negative.data(), width);
+
+                return lhs;
+            }
+
+            auto ret = PartialSum { Nat(width), Nat(width) };
+
+            for (auto&& e : values)
+            {
+                const auto isNegative = BigIntAccess::isNegative(e);
+
+                auto&& acc = isNegative ? ret.negative : ret.positive;
+
+                auto index = 0zu;
+                auto carry = Limb(isNegative ? 1 : 0);
+
+                BigIntAccess::forEachLimb(e, [&](Limb limb_)
+                                          {
+                                              acc[index] = add_with_carry(acc[index], isNegative ? ~limb_ : limb_, carry);
+
+                                              index++;
+                                          });
+
+                add_1(acc.data() + index, acc.data() + index, width - index, carry);
+            }
+
+            return ret;
+        }
+    }
+
+    inline static auto pow      (const akr::BigInt& lhs, const akr::BigInt& rhs) -> akr::BigInt
+    {
+        return akr::BigInt(lhs).pow_assign(rhs);
+    }
+
+    inline static auto sum      (std::span<const akr::BigInt> values) -> akr::BigInt
+    {
+        auto width = 0zu;
+
+        for (auto&& e : values)
+        {
+            width = std::max(width, detail::BigIntAccess::limbCount(e));
+        }
+
+        width += 2 + std::bit_width(values.size()) / detail::LimbBits;
+
+        auto partial = detail::partial_sum(values, width, detail::average_limbs(values));
+
+        detail::nat_trim(partial.positive);
+        detail::nat_trim(partial.negative);
+
+        if (detail::nat_cmp(partial.positive, partial.negative) >= 0)
+        {
+            detail::nat_sub(partial.positive, partial.negative.data(), partial.negative.size());
+
+            return detail::BigIntAccess::fromMagnitude(std::move(partial.positive), false);
+        }
+        else
+        {
+            detail::nat_sub(partial.negative, partial.positive.data(), partial.positive.size());
+
+            return detail::BigIntAccess::fromMagnitude(std::move(partial.negative), true);
+        }
+    }
+
+    namespace detail
+    {
+        template<class F>
+        void elementwise(std::span<BigInt> out, std::span<const BigInt> lhs, std::span<const BigInt> rhs, const F& func)
+        {
+            if (out.size() != lhs.size() || out.size() != rhs.size())
+            {
+                throw std::invalid_argument("sizes are different.");
+            }
+
+            parallel_for(0, out.size(), average_limbs(lhs) + average_limbs(rhs), [&](std::size_t i_)
+                         {
+                             if (&out[i_] == &rhs[i_] && &out[i_] != &lhs[i_])
+                             {
+                                 auto tmp_ = lhs[i_];
+
+                                 func(tmp_, rhs[i_]);
+
+                                 out[i_] = std::move(tmp_);
+                             }
+                             else
+                             {
+                                 out[i_] = lhs[i_];
+
+                                 func(out[i_], rhs[i_]);
+                             }
+                         });
+        }
+
+        template<class F>
+        void elementwise(std::span<BigInt> out, std::span<const BigInt> lhs, const BigInt& rhs, const F& func)
+        {
+            if (out.size() != lhs.size())
+            {
+                throw std::invalid_argument("sizes are different.");
+            }
+
+            // rhs may be an element of out, which the loop overwrites while other elements still read it.
+            const auto isInOut = std::less_equal<>()(out.data(), &rhs) && std::less<>()(&rhs, out.data() + out.size());
+
+            const auto copy = isInOut ? std::optional<BigInt>(rhs) : std::nullopt;
+
+            const auto& value = copy.has_value() ? *copy : rhs;
+
+            parallel_for(0, out.size(), average_limbs(lhs) + BigIntAccess::limbCount(value), [&](std::size_t i_)
+                         {
+                             out[i_] = lhs[i_];
+
+                             func(out[i_], value);
+                         });
+        }
+    }
+
+    // out[i] = lhs[i] + rhs[i], out may be the same span as lhs or rhs, and a single rhs may be an element of out.
+    inline static void add      (std::span<akr::BigInt> out, std::span<const akr::BigInt> lhs, std::span<const akr::BigInt> rhs)
+    {
+        detail::elementwise(out, lhs, rhs, [](auto&& lhs_, auto&& rhs_) { lhs_ += rhs_; });
+    }
+
+    inline static void add      (std::span<akr::BigInt> out, std::span<const akr::BigInt> lhs, const akr::BigInt& rhs)
+    {
+        detail::elementwise(out, lhs, rhs, [](auto&& lhs_, auto&& rhs_) { lhs_ += rhs_; });
+    }
+
+    // out[i] = lhs[i] * rhs[i], out may be the same span as lhs or rhs, and a single rhs may be an element of out.
+    inline static void mul      (std::span<akr::BigInt> out, std::span<const akr::BigInt> lhs, std::span<const akr::BigInt> rhs)
+    {
+        detail::elementwise(out, lhs, rhs, [](auto&& lhs_, auto&& rhs_) { lhs_ *= rhs_; });
+    }
+
+    inline static void mul      (std::span<akr::BigInt> out, std::span<const akr::BigInt> lhs, const akr::BigInt& rhs)
+    {
+        detail::elementwise(out, lhs, rhs, [](auto&& lhs_, auto&& rhs_) { lhs_ *= rhs_; });
+    }
+
+    // out[i] = lhs[i] % rhs[i], out may be the same span as lhs or rhs, and a single rhs may be an element of out.
+    inline static void mod      (std::span<akr::BigInt> out, std::span<const akr::BigInt> lhs, std::span<const akr::BigInt> rhs)
+    {
+        detail::elementwise(out, lhs, rhs, [](auto&& lhs_, auto&& rhs_) { lhs_ %= rhs_; });
+    }
+
+    inline static void mod      (std::span<akr::BigInt> out, std::span<const akr::BigInt> lhs, const akr::BigInt& rhs)
+    {
+        detail::elementwise(out, lhs, rhs, [](auto&& lhs_, auto&& rhs_) { lhs_ %= rhs_; });
+    }
+
+    // out = lhs + rhs. The three-address functions write into the storage out already has and work in buffers the thread
+    // keeps, so a loop whose operand sizes settle stops allocating, below the Karatsuba and recursive division sizes.
+    // out may be lhs or rhs.
+    inline static void add      (akr::BigInt& out, const akr::BigInt& lhs, const akr::BigInt& rhs)
+    {
+        U_AKR_BIGINT_COUNT_OP(Add, std::max(lhs.bit_length(), rhs.bit_length()));
+
+        auto&& s = detail::scratch();
+
+        const auto n = std::max(detail::BigIntAccess::limbCount(lhs), detail::BigIntAccess::limbCount(rhs)) + 1;
+
+        detail::BigIntAccess::limbsInto(lhs, s.a, n);
+        detail::BigIntAccess::limbsInto(rhs, s.b, n);
+
+        detail::add_n(s.a.data(), s.a.data(), s.b.data(), n);
+
+        detail::BigIntAccess::assignLimbs(out, s.a, s.a.back() >> (detail::LimbBits - 1) != 0);
+    }
+
+    // out = lhs - rhs, out may be lhs or rhs.
+    inline static void sub      (akr::BigInt& out, const akr::BigInt& lhs, const akr::BigInt& rhs)
+    {
+        U_AKR_BIGINT_COUNT_OP(Sub, std::max(lhs.bit_length(), rhs.bit_length()));
+
+        auto&& s = detail::scratch();
+
+        const auto n = std::max(detail::BigIntAccess::limbCount(lhs), detail::BigIntAccess::limbCount(rhs)) + 1;
+
+        detail::BigIntAccess::limbsInto(lhs, s.a, n);
+        detail::BigIntAccess::limbsInto(rhs, s.b, n);
+
+        detail::sub_n(s.a.data(), s.a.data(), s.b.data(), n);
+
+        detail::BigIntAccess::assignLimbs(out, s.a, s.a.back() >> (detail::LimbBits - 1) != 0);
+    }
+
+    // out = lhs * rhs, out may be lhs or rhs.
+    inline static void mul      (akr::BigInt& out, const akr::BigInt& lhs, const akr::BigInt& rhs)
+    {
+        U_AKR_BIGINT_COUNT_OP(Mul, std::max(lhs.bit_length(), rhs.bit_length()));
+
+        auto&& s = detail::scratch();
+
+        const auto isNegative = detail::BigIntAccess::isNegative(lhs) != detail::BigIntAccess::isNegative(rhs);
+
+        detail::BigIntAccess::magnitudeInto(lhs, s.a);
+        detail::BigIntAccess::magnitudeInto(rhs, s.b);
+
+        if (s.a.empty() || s.b.empty())
+        {
+            s.r.clear();
+        }
+        else
+        {
+            s.r.resize(s.a.size() + s.b.size());
+
+            detail::mul(s.r.data(), s.a.data(), s.a.size(), s.b.data(), s.b.size());
+        }
+
+        detail::BigIntAccess::assignMagnitude(out, s.r, isNegative);
+    }
+
+    // quotient = lhs / rhs and remainder = lhs % rhs, rounded like the operators. Either may be lhs or rhs,
+    // but not the other one.
+    inline static void divmod   (akr::BigInt& quotient, akr::BigInt& remainder, const akr::BigInt& lhs, const akr::BigInt& rhs)
+    {
+        if (rhs.bit_length() == 0 && !detail::BigIntAccess::isNegative(rhs))
+        {
+            throw std::invalid_argument("right operand is zero.");
+        }
+
+        if (&quotient == &remainder)
+        {
+            throw std::invalid_argument("quotient and remainder are the same.");
+        }
+
+        U_AKR_BIGINT_COUNT_OP(Div, std::max(lhs.bit_length(), rhs.bit_length()));
+
+        auto&& s = detail::scratch();
+
+        const auto isLhsNegative = detail::BigIntAccess::isNegative(lhs);
+
+        const auto isNegative    = isLhsNegative != detail::BigIntAccess::isNegative(rhs);
+
+        detail::BigIntAccess::magnitudeInto(lhs, s.a);
+        detail::BigIntAccess::magnitudeInto(rhs, s.b);
+
+        detail::div_qr(s.q, s.r, s.a, s.b);
+
+        detail::BigIntAccess::assignMagnitude(quotient,  s.q, isNegative);
+        detail::BigIntAccess::assignMagnitude(remainder, s.r, isLhsNegative);
+
+        detail::Scratch::reclaim(s.q);
+        detail::Scratch::reclaim(s.r);
+    }
+
+    inline static auto to_strings  (std::span<const akr::BigInt> values, int base = 10) -> std::vector<std::string>
+    {
+        auto ret = std::vector<std::string>(values.size());
+
+        detail::parallel_for(0, values.size(), detail::average_limbs(values), [&](std::size_t i_)
+                             {
+                                 ret[i_] = values[i_].ToStdString(base);
+                             });
+
+        return ret;
+    }
+
+    inline static auto from_strings(std::span<const std::string_view> numStrViews, std::optional<int> base = std::nullopt) -> std::vector<akr::BigInt>
+    {
+        auto ret = std::vector<akr::BigInt>(numStrViews.size());
+
+        auto chars = 0zu;
+
+        for (auto&& e : numStrViews)
+        {
+            chars += e.size();
+        }
+
+        detail::parallel_for(0, numStrViews.size(), std::max(chars / std::max(numStrViews.size(), 1zu) / 16, 1zu), [&](std::size_t i_)
+                             {
+                                 const auto parsed_ = detail::parse_prefix(numStrViews[i_], base);
+
+                                 ret[i_] = detail::BigIntAccess::fromMagnitude(detail::from_radix_string(parsed_.digits, parsed_.base), parsed_.isNegative);
+                             });
+
+        return ret;
+    }
+
+    // n! by the prime swing algorithm.
+    inline static auto factorial(std::size_t n) -> akr::BigInt
+    {
+        const auto primes = detail::sieve_primes(n);
+
+        return akr::BigInt(detail::BigIntAccess::fromMagnitude(detail::odd_factorial(n, primes), false)) <<= n - std::popcount(n);
+    }
+
+    // n! / (k! (n - k)!) from the prime factorization given by Legendre's formula.
+    inline static auto binomial (std::size_t n, std::size_t k) -> akr::BigInt
+    {
+        if (k > n)
+        {
+            return akr::BigInt();
+        }
+
+        k = std::min(k, n - k);
+
+        auto factors = std::vector<detail::Limb>();
+
+        for (auto&& p : detail::sieve_primes(n))
+        {
+            auto e = 0zu;
+
+            for (auto qn = n / p, qk = k / p, qm = (n - k) / p; qn > 0; qn /= p, qk /= p, qm /= p)
+            {
+                e += qn - qk - qm;
+            }
+
+            factors.insert(factors.end(), e, p);
+        }
+
+        return detail::BigIntAccess::fromMagnitude(detail::limb_product(factors), false);
+    }
+
+    // the product of the primes not greater than n.
+    inline static auto primorial(std::size_t n) -> akr::BigInt
+    {
+        return detail::BigIntAccess::fromMagnitude(detail::limb_product(detail::sieve_primes(n)), false);
+    }
+
+    // the product of the values as a balanced tree.
+    template<std::ranges::input_range R>
+    requires(std::convertible_to<std::ranges::range_value_t<R>, akr::BigInt>)
+    inline static auto product  (R&& range) -> akr::BigInt
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        auto isNegative = false;
+
+        auto values = std::vector<detail::Nat>();
+
+        if constexpr (std::integral<T>)
+        {
+            auto factors = std::vector<detail::Limb>();
+
+            for (auto&& e : range)
+            {
+                auto value = static_cast<std::uintmax_t>(e);
+
+                if constexpr (std::is_signed_v<T>)
+                {
+                    if (e < 0)
+                    {
+                        isNegative = !isNegative;
+
+                        value = 0 - value;
+                    }
+                }
+
+                if (value <= std::numeric_limits<detail::Limb>::max())
+                {
+                    factors.push_back(static_cast<detail::Limb>(value));
+                }
+                else
+                {
+                    values.push_back(detail::BigIntAccess::magnitude(akr::BigInt(e)));
+                }
+            }
+
+            values.push_back(detail::limb_product(factors));
+        }
+        else
+        {
+            for (auto&& e : range)
+            {
+                const auto value = akr::BigInt(e);
+
+                isNegative = isNegative != detail::BigIntAccess::isNegative(value);
+
+                values.push_back(detail::BigIntAccess::magnitude(value));
+            }
+        }
+
+        return detail::BigIntAccess::fromMagnitude(detail::nat_product(values), isNegative);
+    }
+
+    inline static auto to_string(const akr::BigInt& value) -> std::string
+    {
+        return value.ToStdString();
+    }
+
+    namespace detail
+    {
+        // values up to this many limbs are converted on the stack.
+        inline constexpr auto SmallLimbs = 16zu;
+
+        inline constexpr auto SmallChars = SmallLimbs * LimbBits + 1;
+
+        // writes the digits of |value| backwards so they end at end, without touching the heap.
+        // returns the first digit, or nullptr if the value has more than SmallLimbs limbs.
+        inline auto small_digits(const BigInt& value, int base, char* end) -> char*
+        {
+            if (BigIntAccess::limbCount(value) > SmallLimbs)
+            {
+                return nullptr;
+            }
+
+            const auto isNegative = BigIntAccess::isNegative(value);
+
+            auto limbs = std::array<Limb, SmallLimbs + 1> {};
+
+            auto n     = 0zu;
+            auto carry = Limb(isNegative ? 1 : 0);
+
+            BigIntAccess::forEachLimb(value, [&](Limb limb_)
+                                      {
+                                          limbs[n++] = add_with_carry(isNegative ? ~limb_ : limb_, 0, carry);
+                                      });
+
+            limbs[n++] = carry;
+
+            n = normalized_size(limbs.data(), n);
+
+            auto chunkBase   = static_cast<Limb>(base);
+            auto chunkDigits = 1zu;
+
+            for (; chunkBase <= std::numeric_limits<Limb>::max() / static_cast<Limb>(base); chunkDigits++)
+            {
+                chunkBase *= static_cast<Limb>(base);
+            }
+
+            auto p = end;
+
+            for (; n > 0;)
+            {
+                auto chunk = divrem_1(limbs.data(), limbs.data(), n, chunkBase);
+
+                n = normalized_size(limbs.data(), n);
+
+                for (auto j = 0zu; n > 0 ? j < chunkDigits : chunk != 0; j++)
+                {
+                    *--p = digit_to_char(static_cast<int>(chunk % static_cast<Limb>(base)));
+
+                    chunk /= static_cast<Limb>(base);
+                }
+            }
+
+            if (p == end)
+            {
+                *--p = '0';
+            }
+
+            return p;
+        }
+
+        constexpr auto to_lower(char c) noexcept -> char
+        {
+            return 'A' <= c && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+    }
+
+    // the digits of value in [first, last) like std::to_chars: lowercase, a leading '-' only, no allocation for values
+    // up to detail::SmallLimbs limbs. {last, std::errc::value_too_large} if the buffer is too short.
+    inline static auto to_chars  (char* first, char* last, const akr::BigInt& value, int base = 10) -> std::to_chars_result
+    {
+        if (!(2 <= base && base <= 36))
+        {
+            throw std::invalid_argument("base is invalid.");
+        }
+
+        const auto isNegative = detail::BigIntAccess::isNegative(value);
+
+        auto buffer = std::array<char, detail::SmallChars> {};
+
+        if (const auto digits = detail::small_digits(value, base, buffer.data() + buffer.size()))
+        {
+            const auto size = static_cast<std::size_t>(buffer.data() + buffer.size() - digits) + (isNegative ? 1 : 0);
+
+            if (size > static_cast<std::size_t>(last - first))
+            {
+                return { last, std::errc::value_too_large };
+            }
+
+            if (isNegative)
+            {
+                *first++ = '-';
+            }
+
+            return { std::transform(digits, buffer.data() + buffer.size(), first, detail::to_lower), std::errc() };
+        }
+
+        auto isFit = true;
+
+        const auto sink = [&](std::string_view digits_)
+        {
+            if (!isFit || digits_.size() > static_cast<std::size_t>(last - first))
+            {
+                isFit = false;
+
+                return;
+            }
+
+            first = std::transform(digits_.begin(), digits_.end(), first, detail::to_lower);
+        };
+
+        if (isNegative)
+        {
+            sink("-");
+        }
+
+        detail::write_radix(detail::BigIntAccess::magnitude(value), base, sink);
+
+        if (!isFit)
+        {
+            return { last, std::errc::value_too_large };
+        }
+
+        return { first, std::errc() };
+    }
+
+    // parses an optional '-' and the longest run of digits like std::from_chars, value is left alone on failure.
+    inline static auto from_chars(const char* first, const char* last, akr::BigInt& value, int base = 10) -> std::from_chars_result
+    {
+        if (!(2 <= base && base <= 36))
+        {
+            throw std::invalid_argument("base is invalid.");
+        }
+
+        const auto isNegative = first != last && *first == '-';
+
+        const auto digits = first + (isNegative ? 1 : 0);
+
+        const auto digitsEnd = std::find_if(digits, last, [base](char c_)
+                                            {
+                                                const auto digit_ = detail::char_to_digit(c_);
+
+                                                return !(0 <= digit_ && digit_ < base);
+                                            });
+
+        if (digitsEnd == digits)
+        {
+            return { first, std::errc::invalid_argument };
+        }
+
+        const auto digitsView = std::string_view(digits, static_cast<std::size_t>(digitsEnd - digits));
+
+        // short inputs are accumulated on the stack, so only the storage of value itself is allocated.
+        if (digitsView.size() * static_cast<std::size_t>(std::bit_width(static_cast<unsigned>(base))) <= detail::SmallLimbs * detail::LimbBits)
+        {
+            auto limbs = std::array<detail::Limb, detail::SmallLimbs + 1> {};
+
+            detail::parse_magnitude(limbs.data(), limbs.size(), digitsView, base);
+
+            const auto n = detail::normalized_size(limbs.data(), limbs.size());
+
+            if (isNegative && n > 0)
+            {
+                for (auto i = 0zu; i < n; i++)
+                {
+                    limbs[i] = ~limbs[i];
+                }
+
+                detail::add_1(limbs.data(), limbs.data(), n, 1);
+            }
+
+            value = detail::BigIntAccess::fromLimbs(std::span(limbs.data(), n), isNegative && n > 0);
+        }
+        else
+        {
+            value = detail::BigIntAccess::fromMagnitude(detail::from_radix_string(digitsView, base), isNegative);
+        }
+
+        return { digitsEnd, std::errc() };
+    }
+
+    namespace detail
+    {
+        // the format spec of BigInt: [[fill]align][sign][#][0][width][grouping][type], where grouping is one of , _ '
+        // and separates groups of 3 decimal or 4 other digits, and type is one of b B o d x X.
+        struct FormatSpec final
+        {
+            char        fill        = ' ';
+
+            char        align       = '\0';
+
+            char        sign        = '-';
+
+            bool        isAlternate = false;
+
+            bool        isZeroPad   = false;
+
+            std::size_t width       = 0;
+
+            char        grouping    = '\0';
+
+            char        type        = 'd';
+
+            // returns the position of the closing brace, throws Error if the spec is malformed. An empty spec such as
+            // "{}" hands over a range that starts at its closing brace and runs on to the end of the format string.
+            template<class Error, class I>
+            constexpr auto parse(I first, I last) -> I
+            {
+                if (first == last || *first == '}')
+                {
+                    return first;
+                }
+
+                const auto isAlign_ = [](char c_) { return c_ == '<' || c_ == '>' || c_ == '^'; };
+
+                if (last - first >= 2 && isAlign_(first[1]))
+                {
+                    if (first[0] == '{')
+                    {
+                        throw Error("format is invalid.");
+                    }
+
+                    fill  = first[0];
+                    align = first[1];
+
+                    first += 2;
+                }
+                else if (first != last && isAlign_(*first))
+                {
+                    align = *first++;
+                }
+
+                if (first != last && (*first == '+' || *first == '-' || *first == ' '))
+                {
+                    sign = *first++;
+                }
+
+                if (first != last && *first == '#')
+                {
+                    isAlternate = true;
+
+                    first++;
+                }
+
+                if (first != last && *first == '0')
+                {
+                    isZeroPad = true;
+
+                    first++;
+                }
+
+                for (; first != last && '0' <= *first && *first <= '9'; first++)
+                {
+                    width = width * 10 + static_cast<std::size_t>(*first - '0');
+                }
+
+                if (first != last && (*first == ',' || *first == '_' || *first == '\''))
+                {
+                    grouping = *first++;
+                }
+
+                if (first != last && std::string_view("bBodxX").find(*first) != std::string_view::npos)
+                {
+                    type = *first++;
+                }
+
+                if (first != last && *first != '}')
+                {
+                    throw Error("format is invalid.");
+                }
+
+                return first;
+            }
+
+            auto base() const noexcept -> int
+            {
+                switch (type)
+                {
+                    case 'b':
+                        [[fallthrough]];
+                    case 'B':
+                        return 0B10;
+                    case 'o':
+                        return 010;
+                    case 'x':
+                        [[fallthrough]];
+                    case 'X':
+                        return 0X10;
+                    default:
+                        return 10;
+                }
+            }
+
+            template<class O>
+            auto format(const BigInt& value, O out) const -> O
+            {
+                auto buffer = std::array<char, SmallChars> {};
+
+                auto large = std::string();
+
+                auto digits = std::string_view();
+
+                if (const auto first = small_digits(value, base(), buffer.data() + buffer.size()))
+                {
+                    digits = std::string_view(first, static_cast<std::size_t>(buffer.data() + buffer.size() - first));
+                }
+                else
+                {
+                    large = value.ToStdString(base());
+
+                    digits = std::string_view(large).substr(BigIntAccess::isNegative(value) ? 1 : 0);
+                }
+
+                const auto isUpper = type == 'X' || type == 'B';
+
+                const auto signChar = BigIntAccess::isNegative(value) ? '-' : sign == '-' ? '\0' : sign;
+
+                auto prefix = std::string_view();
+
+                if (isAlternate)
+                {
+                    switch (type)
+                    {
+                        case 'b':
+                            prefix = "0b";
+                            break;
+                        case 'B':
+                            prefix = "0B";
+                            break;
+                        case 'o':
+                            prefix = digits != "0" ? "0" : "";
+                            break;
+                        case 'x':
+                            prefix = "0x";
+                            break;
+                        case 'X':
+                            prefix = "0X";
+                            break;
+                        default:
+                            break;
+                    }
+                }
+
+                const auto groupSize = base() == 10 ? 3zu : 4zu;
+
+                const auto groups = grouping != '\0' ? (digits.size() - 1) / groupSize : 0;
+
+                const auto size = (signChar != '\0' ? 1 : 0) + prefix.size() + digits.size() + groups;
+
+                const auto padding = width > size ? width - size : 0;
+
+                const auto isZeros = isZeroPad && align == '\0';
+
+                const auto before = isZeros ? 0 : align == '<' ? 0 : align == '^' ? padding / 2 : padding;
+
+                const auto after  = isZeros ? 0 : padding - before;
+
+                for (auto i = 0zu; i < before; i++)
+                {
+                    *out++ = fill;
+                }
+
+                if (signChar != '\0')
+                {
+                    *out++ = signChar;
+                }
+
+                for (auto c : prefix)
+                {
+                    *out++ = c;
+                }
+
+                for (auto i = 0zu; isZeros && i < padding; i++)
+                {
+                    *out++ = '0';
+                }
+
+                for (auto i = 0zu; i < digits.size(); i++)
+                {
+                    if (groups > 0 && i > 0 && (digits.size() - i) % groupSize == 0)
+                    {
+                        *out++ = grouping;
+                    }
+
+                    *out++ = isUpper ? digits[i] : to_lower(digits[i]);
+                }
+
+                for (auto i = 0zu; i < after; i++)
+                {
+                    *out++ = fill;
+                }
+
+                return out;
+            }
+        };
+    }
+
+    namespace detail
+    {
+        inline constexpr auto HashPrimes = std::array<std::uint64_t, 5>
+        {
+            0X9E3779B185EBCA87, 0XC2B2AE3D27D4EB4F, 0X165667B19E3779F9, 0X85EBCA77C2B2AE63, 0X27D4EB2F165667C5,
+        };
+
+        constexpr auto hash_round(std::uint64_t acc, std::uint64_t input) noexcept -> std::uint64_t
+        {
+            return std::rotl(acc + input * HashPrimes[1], 31) * HashPrimes[0];
+        }
+
+        // the xxHash64 scheme over the limbs: four independent lanes keep several multiplications in flight,
+        // and the limbs are read straight from the bitset. The representation is canonical, so equal values hash equally.
+        inline auto hash_value(const BigInt& value) noexcept -> std::size_t
+        {
+            auto lanes = std::array<std::uint64_t, 4>
+            {
+                HashPrimes[0] + HashPrimes[1], HashPrimes[1], 0, 0 - HashPrimes[0],
+            };
+
+            auto count = 0zu;
+
+            BigIntAccess::forEachLimb(value, [&](Limb limb_)
+                                      {
+                                          auto&& lane_ = lanes[count % lanes.size()];
+
+                                          lane_ = hash_round(lane_, static_cast<std::uint64_t>(limb_));
+
+                                          count++;
+                                      });
+
+            auto ret = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+
+            for (auto&& e : lanes)
+            {
+                ret = (ret ^ hash_round(0, e)) * HashPrimes[0] + HashPrimes[3];
+            }
+
+            ret += static_cast<std::uint64_t>(count) * sizeof(Limb) + (BigIntAccess::isNegative(value) ? HashPrimes[4] : 0);
+
+            ret ^= ret >> 33;
+            ret *= HashPrimes[1];
+            ret ^= ret >> 29;
+            ret *= HashPrimes[2];
+            ret ^= ret >> 32;
+
+            return static_cast<std::size_t>(ret);
+        }
+    }
+
+    // an immutable BigInt whose decimal string and hash are computed once, on first use, and then shared by all copies.
+    // copies are cheap and the caches are safe to fill from several threads.
+    struct FrozenBigInt final
+    {
+        private:
+        struct State final
+        {
+            const BigInt                     value;
+
+            mutable std::once_flag           stdStringFlag;
+
+            mutable std::string              stdString;
+
+            mutable std::atomic<std::size_t> hash     = 0;
+
+            mutable std::atomic<bool>        isHashed = false;
+
+            explicit State(BigInt value_):
+                value(std::move(value_))
+            {
+            }
+        };
+
+        private:
+        std::shared_ptr<const State> state;
+
+        public:
+        FrozenBigInt():
+            FrozenBigInt(BigInt())
+        {
+        }
+
+        FrozenBigInt(BigInt value):
+            state(std::make_shared<const State>(std::move(value)))
+        {
+        }
+
+        FrozenBigInt(const FrozenBigInt&) = default;
+
+        auto operator=(const FrozenBigInt&) -> FrozenBigInt& = default;
+
+        public:
+        auto value      () const noexcept -> const BigInt&
+        {
+            return state->value;
+        }
+
+        operator const BigInt&() const noexcept
+        {
+            return state->value;
+        }
+
+        auto ToStdString() const -> const std::string&
+        {
+            std::call_once(state->stdStringFlag, [this] { state->stdString = state->value.ToStdString(); });
+
+            return state->stdString;
+        }
+
+        auto hash       () const noexcept -> std::size_t
+        {
+            if (!state->isHashed.load(std::memory_order_acquire))
+            {
+                state->hash.store(detail::hash_value(state->value), std::memory_order_relaxed);
+
+                state->isHashed.store(true, std::memory_order_release);
+            }
+
+            return state->hash.load(std::memory_order_relaxed);
+        }
+
+        public:
+        friend auto operator==(const FrozenBigInt& lhs, const FrozenBigInt& rhs) noexcept -> bool
+        {
+            if (lhs.state == rhs.state)
+            {
+                return true;
+            }
+
+            if (lhs.state->isHashed.load(std::memory_order_acquire) && rhs.state->isHashed.load(std::memory_order_acquire) &&
+                lhs.state->hash.load(std::memory_order_relaxed) != rhs.state->hash.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            return lhs.value() == rhs.value();
+        }
+        friend auto operator!=(const FrozenBigInt& lhs, const FrozenBigInt& rhs) noexcept -> bool
+        {
+            return !(lhs == rhs);
+        }
+
+        friend auto operator<<(std::ostream& lhs, const FrozenBigInt& rhs) -> std::ostream&
+        {
+            return lhs << rhs.ToStdString();
+        }
+    };
+
+    // a divisor prepared once for many divisions by it: its magnitude is kept shifted so that the top bit is set,
+    // with the reciprocal of its top limb, so that each quotient limb costs two multiplications instead of a
+    // hardware division. Division by a single limb such as 10^19 gains the most. Rounds like the operators.
+    // Remainders by 2^k - c or 2^k + c for a small c are folded as by %=.
+    struct Divisor final
+    {
+        private:
+        BigInt          divisor;
+
+        detail::Nat     magnitude;
+
+        detail::Nat     normalized;
+
+        std::size_t     shift      = 0;
+
+        detail::Limb    reciprocal = 0;
+
+        std::optional<detail::SpecialForm> form;
+
+        public:
+        explicit Divisor(BigInt value):
+            divisor   (std::move(value)),
+            magnitude (detail::BigIntAccess::magnitude(divisor)),
+            normalized(magnitude.size())
+        {
+            if (magnitude.empty())
+            {
+                throw std::invalid_argument("divisor is zero.");
+            }
+
+            shift = static_cast<std::size_t>(std::countl_zero(magnitude.back()));
+
+            if (shift > 0)
+            {
+                detail::lshift(normalized.data(), magnitude.data(), magnitude.size(), shift);
+            }
+            else
+            {
+                normalized = magnitude;
+            }
+
+            reciprocal = detail::reciprocal_limb(normalized.back());
+
+            form       = detail::SpecialForm::detect(magnitude);
+        }
+
+        public:
+        auto value() const noexcept -> const BigInt&
+        {
+            return divisor;
+        }
+
+        public:
+        friend auto operator/ (const BigInt& lhs, const Divisor& rhs) -> BigInt
+        {
+            auto ret = BigInt();
+
+            rhs.divide(&ret, nullptr, lhs);
+
+            return ret;
+        }
+        friend auto operator% (const BigInt& lhs, const Divisor& rhs) -> BigInt
+        {
+            auto ret = BigInt();
+
+            rhs.divide(nullptr, &ret, lhs);
+
+            return ret;
+        }
+
+        friend auto operator/=(BigInt& lhs, const Divisor& rhs) -> BigInt&
+        {
+            rhs.divide(&lhs, nullptr, lhs);
+
+            return lhs;
+        }
+        friend auto operator%=(BigInt& lhs, const Divisor& rhs) -> BigInt&
+        {
+            rhs.divide(nullptr, &lhs, lhs);
+
+            return lhs;
+        }
+
+        // quotient = lhs / rhs and remainder = lhs % rhs, either may be lhs but not the other one.
+        friend void divmod(BigInt& quotient, BigInt& remainder, const BigInt& lhs, const Divisor& rhs)
+        {
+            if (&quotient == &remainder)
+            {
+                throw std::invalid_argument("quotient and remainder are the same.");
+            }
+
+            rhs.divide(&quotient, &remainder, lhs);
+        }
+
+        private:
+        void divide(BigInt* quotient, BigInt* remainder, const BigInt& lhs) const
+        {
+            U_AKR_BIGINT_COUNT_OP(Div, std::max(lhs.bit_length(), divisor.bit_length()));
+
+            auto&& s = detail::scratch();
+
+            const auto isLhsNegative = detail::BigIntAccess::isNegative(lhs);
+
+            const auto isNegative    = isLhsNegative != detail::BigIntAccess::isNegative(divisor);
+
+            detail::BigIntAccess::magnitudeInto(lhs, s.a);
+
+            const auto an = s.a.size();
+            const auto dn = normalized.size();
+
+            if (an < dn)
+            {
+                s.q.clear();
+
+                s.r.swap(s.a);
+            }
+            else if (form && quotient == nullptr)
+            {
+                form->reduce(s.a, s.b);
+
+                s.r.swap(s.a);
+            }
+            else if (dn == 1)
+            {
+                s.q.resize(an);
+
+                s.r.assign(1, detail::divrem_1_preinv(s.q.data(), s.a.data(), an, normalized[0], shift, reciprocal));
+            }
+            else if (const auto divThreshold = std::max(detail::thresholds().divRecursive, 2zu); an - dn >= divThreshold && dn >= divThreshold)
+            {
+                detail::div_qr(s.q, s.r, s.a, magnitude);
+            }
+            else
+            {
+                U_AKR_BIGINT_COUNT_TIER(DivBasecase);
+
+                s.un.resize(an + 1);
+                s.q .resize(an - dn + 1);
+
+                if (shift > 0)
+                {
+                    s.un[an] = detail::lshift(s.un.data(), s.a.data(), an, shift);
+                }
+                else
+                {
+                    std::copy(s.a.begin(), s.a.end(), s.un.begin());
+
+                    s.un[an] = 0;
+                }
+
+                detail::divrem_preinv(s.q.data(), s.un.data(), an, normalized.data(), dn, reciprocal);
+
+                s.r.resize(dn);
+
+                if (shift > 0)
+                {
+                    detail::rshift(s.r.data(), s.un.data(), dn, shift);
+                }
+                else
+                {
+                    std::copy(s.un.begin(), s.un.begin() + static_cast<std::ptrdiff_t>(dn), s.r.begin());
+                }
+            }
+
+            if (quotient != nullptr)
+            {
+                detail::BigIntAccess::assignMagnitude(*quotient,  s.q, isNegative);
+            }
+
+            if (remainder != nullptr)
+            {
+                detail::BigIntAccess::assignMagnitude(*remainder, s.r, isLhsNegative);
+            }
+
+            detail::Scratch::reclaim(s.a);
+            detail::Scratch::reclaim(s.b);
+            detail::Scratch::reclaim(s.q);
+            detail::Scratch::reclaim(s.r);
+        }
+    };
+
+    // a running sum of many values that defers its carries. Each addition chains its carry only across the limbs of
+    // the value and keeps the carry out of them, with the sign of the value, in a signed counter at the limb above,
+    // so no addition walks the rest of the sum. The counters are resolved when value() is read.
+    struct BigIntAccumulator final
+    {
+        private:
+        using Limb = detail::Limb;
+
+        private:
+        // the sum is limbs[i] + counters[i], weighted by 2^(i * LimbBits), over all i. Every addition moves one
+        // counter by at most one, so none can overflow before 2^63 additions.
+        detail::Nat                                                limbs;
+
+        std::vector<std::int64_t, detail::Allocator<std::int64_t>> counters;
+
+        public:
+        BigIntAccumulator() = default;
+
+        public:
+        auto operator+=(const BigInt& rhs) -> BigIntAccumulator&
+        {
+            auto&& lhs = *this;
+
+            lhs.accumulate(detail::BigIntAccess::limbCount(rhs), detail::BigIntAccess::isNegative(rhs), false,
+                           [&](const auto& func_) { detail::BigIntAccess::forEachLimb(rhs, func_); });
+
+            return lhs;
+        }
+        auto operator-=(const BigInt& rhs) -> BigIntAccumulator&
+        {
+            auto&& lhs = *this;
+
+            lhs.accumulate(detail::BigIntAccess::limbCount(rhs), detail::BigIntAccess::isNegative(rhs), true,
+                           [&](const auto& func_) { detail::BigIntAccess::forEachLimb(rhs, func_); });
+
+            return lhs;
+        }
+
+        template<std::integral T>
+        auto operator+=(T rhs) -> BigIntAccumulator&
+        {
+            auto&& lhs = *this;
+
+            lhs.accumulate(1, isNegativeValue(rhs), false, [&](const auto& func_) { func_(static_cast<Limb>(rhs)); });
+
+            return lhs;
+        }
+        template<std::integral T>
+        auto operator-=(T rhs) -> BigIntAccumulator&
+        {
+            auto&& lhs = *this;
+
+            lhs.accumulate(1, isNegativeValue(rhs), true,  [&](const auto& func_) { func_(static_cast<Limb>(rhs)); });
+
+            return lhs;
+        }
+
+        public:
+        // the sum, normalized.
+        auto value() const -> BigInt
+        {
+            auto sum = detail::Nat(limbs.size() + 1);
+
+            // the carry into each limb, it stays within [-2, 2].
+            auto carry = std::int64_t(0);
+
+            for (auto i = 0zu; i < limbs.size(); i++)
+            {
+                const auto lhs = limbs[i] + static_cast<Limb>(carry);
+                const auto rhs = lhs + static_cast<Limb>(counters[i]);
+
+                sum[i] = rhs;
+
+                carry = static_cast<std::int64_t>(lhs < limbs[i]) + static_cast<std::int64_t>(rhs < lhs) -
+                        static_cast<std::int64_t>(carry < 0) - static_cast<std::int64_t>(counters[i] < 0);
+            }
+
+            sum.back() = static_cast<Limb>(carry);
+
+            return detail::BigIntAccess::fromLimbs(sum, carry < 0);
+        }
+
+        // sets the sum to zero and keeps the storage.
+        void clear() noexcept
+        {
+            std::fill(limbs.begin(), limbs.end(), Limb(0));
+
+            std::fill(counters.begin(), counters.end(), std::int64_t(0));
+        }
+
+        private:
+        template<class T>
+        static constexpr auto isNegativeValue(T value) noexcept -> bool
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                return value < 0;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        // adds or subtracts the value whose n two's complement limbs forEach yields, sign extended by isNegative.
+        template<class F>
+        void accumulate(std::size_t n, bool isNegative, bool isSubtraction, const F& forEach)
+        {
+            if (limbs.size() < n + 1)
+            {
+                limbs.resize(n + 1);
+
+                counters.resize(n + 1);
+            }
+
+            auto index = 0zu;
+            auto carry = Limb(0);
+
+            if (isSubtraction)
+            {
+                forEach([&](Limb limb_)
+                        {
+                            limbs[index] = detail::sub_with_borrow(limbs[index], limb_, carry);
+
+                            index++;
+                        });
+
+                counters[n] += static_cast<std::int64_t>(isNegative) - static_cast<std::int64_t>(carry);
+            }
+            else
+            {
+                forEach([&](Limb limb_)
+                        {
+                            limbs[index] = detail::add_with_carry (limbs[index], limb_, carry);
+
+                            index++;
+                        });
+
+                counters[n] += static_cast<std::int64_t>(carry) - static_cast<std::int64_t>(isNegative);
+            }
+        }
+    };
+
+    namespace detail
+    {
+        // the operations every modular context shares: residues are n-limb buffers of values below m.
+        struct Residues
+        {
+            Nat         modulus;
+
+            std::size_t n;
+
+            Nat         one;
+
+            explicit Residues(Nat modulus_):
+                modulus(std::move(modulus_)), n(modulus.size())
+            {
+            }
+
+            void add(Limb* rp, const Limb* ap, const Limb* bp) const noexcept
+            {
+                if (add_n(rp, ap, bp, n) != 0 || cmp(rp, modulus.data(), n) >= 0)
+                {
+                    sub_n(rp, rp, modulus.data(), n);
+                }
+            }
+
+            void sub(Limb* rp, const Limb* ap, const Limb* bp) const noexcept
+            {
+                if (sub_n(rp, ap, bp, n) != 0)
+                {
+                    add_n(rp, rp, modulus.data(), n);
+                }
+            }
+
+            // rp = ap / 2 mod m, for an odd m.
+            void half(Limb* rp, const Limb* ap) const noexcept
+            {
+                auto carry = Limb(0);
+
+                if (ap[0] % 2 != 0)
+                {
+                    carry = add_n(rp, ap, modulus.data(), n);
+                }
+                else
+                {
+                    std::copy(ap, ap + n, rp);
+                }
+
+                rshift(rp, rp, n, 1);
+
+                rp[n - 1] |= carry << (LimbBits - 1);
+            }
+
+            auto equal(const Nat& x, const Nat& y) const noexcept -> bool
+            {
+                return cmp(x.data(), y.data(), n) == 0;
+            }
+
+            auto is_zero(const Nat& x) const noexcept -> bool
+            {
+                return normalized_size(x.data(), n) == 0;
+            }
+        };
+
+        // base ^ exponent in a modular context with a fixed window of four bits, base and result are residues.
+        template<class Context>
+        auto residue_pow(Context& ctx, const Nat& base, const Nat& exponent) -> Nat
+        {
+            auto table = std::vector<Nat>(16, Nat(ctx.n));
+
+            table[0] = ctx.one;
+            table[1] = base;
+
+            for (auto i = 2zu; i < table.size(); i++)
+            {
+                ctx.mul(table[i].data(), table[i - 1].data(), base.data());
+            }
+
+            auto ret = ctx.one;
+
+            auto isOne = true;
+
+            for (auto i = exponent.size() * LimbBits; i > 0;)
+            {
+                i -= 4;
+
+                const auto window = (exponent[i / LimbBits] >> (i % LimbBits)) & 15;
+
+                if (!isOne)
+                {
+                    for (auto j = 0; j < 4; j++)
+                    {
+                        ctx.mul(ret.data(), ret.data(), ret.data());
+                    }
+                }
+
+                if (window != 0)
+                {
+                    ctx.mul(ret.data(), ret.data(), table[window].data());
+
+                    isOne = false;
+                }
+            }
+
+            return ret;
+        }
+
+        // arithmetic modulo an odd m of n limbs on residues kept as x * R mod m, R = B^n, so that a product
+        // costs a multiplication and a reduction by the low limbs of m instead of a division.
+        // the scratch makes an instance usable by one thread at a time.
+        struct Montgomery final : Residues
+        {
+            Limb        inverse;
+
+            Nat         scratch;
+
+            explicit Montgomery(Nat odd):
+                Residues(std::move(odd)), inverse(0), scratch(n * 2)
+            {
+                // m * m = 1 mod 8 for odd m, and every Newton step doubles the correct low bits.
+                auto x = modulus[0];
+
+                for (auto i = 0; i < 5; i++)
+                {
+                    x *= 2 - modulus[0] * x;
+                }
+
+                inverse = 0 - x;
+
+                one = to(Nat(1, 1));
+            }
+
+            // x * R mod m for any magnitude x.
+            auto to(const Nat& x) const -> Nat
+            {
+                auto shifted = Nat(n + x.size());
+
+                std::copy(x.begin(), x.end(), shifted.begin() + n);
+
+                nat_trim(shifted);
+
+                auto q = Nat();
+                auto r = Nat();
+
+                div_qr(q, r, shifted, modulus);
+
+                r.resize(n);
+
+                return r;
+            }
+
+            // the magnitude of a residue, x / R mod m.
+            auto from(const Nat& x) -> Nat
+            {
+                auto unit = Nat(n);
+                auto ret  = Nat(n);
+
+                unit[0] = 1;
+
+                mul(ret.data(), x.data(), unit.data());
+
+                nat_trim(ret);
+
+                return ret;
+            }
+
+            // rp = ap * bp / R mod m, rp may alias the operands.
+            void mul(Limb* rp, const Limb* ap, const Limb* bp)
+            {
+                const auto tp = scratch.data();
+
+                detail::mul(tp, ap, n, bp, n);
+
+                auto top = Limb(0);
+
+                for (auto i = 0zu; i < n; i++)
+                {
+                    const auto carry = addmul_1(tp + i, modulus.data(), n, tp[i] * inverse);
+
+                    tp[i + n] = add_with_carry(tp[i + n], carry, top);
+                }
+
+                if (top != 0 || cmp(tp + n, modulus.data(), n) >= 0)
+                {
+                    sub_n(rp, tp + n, modulus.data(), n);
+                }
+                else
+                {
+                    std::copy(tp + n, tp + n * 2, rp);
+                }
+            }
+
+            auto pow(const Nat& base, const Nat& exponent) -> Nat
+            {
+                return residue_pow(*this, base, exponent);
+            }
+        };
+
+        // arithmetic modulo m = 2^k - c or 2^k + c on plain residues, each product reduced by the folds of its
+        // SpecialForm. It wins over Montgomery from a few limbs on, where the reduction of Montgomery costs as much as
+        // a basecase product and a fold stays linear. The buffers make an instance usable by one thread at a time.
+        struct SpecialModulus final : Residues
+        {
+            SpecialForm form;
+
+            Nat         product;
+
+            Nat         high;
+
+            SpecialModulus(Nat modulus_, SpecialForm form_):
+                Residues(std::move(modulus_)), form(form_)
+            {
+                one = to(Nat(1, 1));
+            }
+
+            // the moduli from which folding beats Montgomery's reduction.
+            static auto detect(const Nat& m) noexcept -> std::optional<SpecialForm>
+            {
+                return m.size() >= 5 ? SpecialForm::detect(m) : std::nullopt;
+            }
+
+            auto to(const Nat& x) -> Nat
+            {
+                auto ret = x;
+
+                form.reduce(ret, high);
+
+                ret.resize(n);
+
+                return ret;
+            }
+
+            auto from(const Nat& x) const -> Nat
+            {
+                auto ret = x;
+
+                nat_trim(ret);
+
+                return ret;
+            }
+
+            // rp = ap * bp mod m, rp may alias the operands.
+            void mul(Limb* rp, const Limb* ap, const Limb* bp)
+            {
+                product.resize(n * 2);
+
+                detail::mul(product.data(), ap, n, bp, n);
+
+                if (!form.isPlus)
+                {
+                    fold(rp, product.data());
+
+                    return;
+                }
+
+                nat_trim(product);
+
+                form.reduce(product, high);
+
+                std::copy(product.begin(), product.end(), rp);
+                std::fill(rp + product.size(), rp + n, Limb(0));
+            }
+
+            // rp[0, n) = tp[0, 2n) mod m for a product of residues and m = 2^k - c, on buffers of fixed size: the
+            // first fold leaves below 2^(k + 33), the second below 2^k + 2^65 and a third of at most c below 2^k.
+            void fold(Limb* rp, Limb* tp)
+            {
+                const auto kl   = form.k / LimbBits;
+                const auto kb   = form.k % LimbBits;
+                const auto mask = kb > 0 ? (Limb(1) << kb) - 1 : ~Limb(0);
+                const auto hn   = n * 2 - kl;
+
+                high.resize(hn + 1);
+
+                const auto hp = high.data();
+
+                if (kb > 0)
+                {
+                    rshift(hp, tp + kl, hn, kb);
+                }
+                else
+                {
+                    std::copy(tp + kl, tp + n * 2, hp);
+                }
+
+                hp[hn] = mul_1(hp, hp, hn, form.c);
+
+                tp[n - 1] &= mask;
+
+                detail::add(tp, hp, n + 1, tp, n);
+
+                // the bits from k up, under 2^33 now.
+                const auto top = kb > 0 ? (tp[n - 1] >> kb) | (tp[n] << (LimbBits - kb)) : tp[n];
+
+                tp[n - 1] &= mask;
+
+                auto carry = std::array<Limb, 2> {};
+
+                carry[0] = mul_wide(top, form.c, carry[1]);
+
+                tp[n] = detail::add(tp, tp, n, carry.data(), 2);
+
+                if (tp[n] != 0 || (tp[n - 1] & ~mask) != 0)
+                {
+                    tp[n]      = 0;
+                    tp[n - 1] &= mask;
+
+                    add_1(tp, tp, n, form.c);
+                }
+
+                if (cmp(tp, modulus.data(), n) >= 0)
+                {
+                    sub_n(rp, tp, modulus.data(), n);
+                }
+                else
+                {
+                    std::copy(tp, tp + n, rp);
+                }
+            }
+
+            auto pow(const Nat& base, const Nat& exponent) -> Nat
+            {
+                return residue_pow(*this, base, exponent);
+            }
+        };
+
+        // primes below this are found by trial division, and odd numbers below its square need no further test.
+        inline constexpr auto TrialBound = Limb(1) << 12;
+
+        inline auto trial_primes() -> const std::vector<Limb>&
+        {
+            static const auto ret = sieve_primes(TrialBound);
+
+            return ret;
+        }
+
+        constexpr auto mod_1(const Limb* ap, std::size_t n, Limb d) noexcept -> Limb
+        {
+            auto rem = Limb(0);
+
+            for (auto i = n; i > 0; i--)
+            {
+                div_wide(rem, ap[i - 1], d, rem);
+            }
+
+            return rem;
+        }
+
+        // the smallest prime below TrialBound dividing x, 0 if there is none. The primes are packed into limb-sized
+        // products so that one pass over x serves a whole group of them.
+        inline auto small_factor(const Nat& x) -> Limb
+        {
+            auto&& primes = trial_primes();
+
+            for (auto i = 0zu; i < primes.size();)
+            {
+                auto product = primes[i];
+                auto last    = i + 1;
+
+                for (; last < primes.size() && product <= std::numeric_limits<Limb>::max() / primes[last]; last++)
+                {
+                    product *= primes[last];
+                }
+
+                const auto rem = mod_1(x.data(), x.size(), product);
+
+                for (; i < last; i++)
+                {
+                    if (rem % primes[i] == 0)
+                    {
+                        return primes[i];
+                    }
+                }
+            }
+
+            return 0;
+        }
+
+        // the Jacobi symbol (a / m) for odd m.
+        constexpr auto jacobi(Limb a, Limb m) noexcept -> int
+        {
+            auto ret = 1;
+
+            for (a %= m; a != 0; a %= m)
+            {
+                for (; a % 2 == 0;)
+                {
+                    a /= 2;
+
+                    if (m % 8 == 3 || m % 8 == 5)
+                    {
+                        ret = -ret;
+                    }
+                }
+
+                std::swap(a, m);
+
+                if (a % 4 == 3 && m % 4 == 3)
+                {
+                    ret = -ret;
+                }
+            }
+
+            return m == 1 ? ret : 0;
+        }
+
+        // the Jacobi symbol (d / x) for a small d and an odd magnitude x, by reciprocity.
+        inline auto jacobi(std::int64_t d, const Nat& x) noexcept -> int
+        {
+            const auto a = static_cast<Limb>(d < 0 ? -d : d);
+
+            auto ret = jacobi(mod_1(x.data(), x.size(), a), a);
+
+            if (a % 4 == 3 && x[0] % 4 == 3)
+            {
+                ret = -ret;
+            }
+
+            if (d < 0 && x[0] % 4 == 3)
+            {
+                ret = -ret;
+            }
+
+            return ret;
+        }
+
+        inline auto is_square(const BigInt& x) -> bool
+        {
+            auto root = BigInt(1) << (x.bit_length() + 1) / 2;
+
+            for (;;)
+            {
+                auto next = (root + x / root) >> 1;
+
+                if (next >= root)
+                {
+                    break;
+                }
+
+                root = std::move(next);
+            }
+
+            return root * root == x;
+        }
+
+        // x >> bits for a magnitude.
+        inline auto nat_shr(const Nat& x, std::size_t bits) -> Nat
+        {
+            auto ret = Nat(x.begin() + static_cast<std::ptrdiff_t>(std::min(bits / LimbBits, x.size())), x.end());
+
+            if (bits % LimbBits != 0)
+            {
+                rshift(ret.data(), ret.data(), ret.size(), bits % LimbBits);
+            }
+
+            nat_trim(ret);
+
+            return ret;
+        }
+
+        inline auto nat_countr_zero(const Nat& x) noexcept -> std::size_t
+        {
+            auto i = 0zu;
+
+            for (; x[i] == 0; i++)
+            {
+            }
+
+            return i * LimbBits + static_cast<std::size_t>(std::countr_zero(x[i]));
+        }
+
+        // the strong probable prime test to a residue base, for an odd x = d * 2^s + 1 of the context.
+        template<class Context>
+        auto miller_rabin(Context& ctx, const Nat& base, const Nat& d, std::size_t s) -> bool
+        {
+            auto minus = Nat(ctx.n);
+
+            ctx.sub(minus.data(), minus.data(), ctx.one.data());
+
+            auto y = ctx.pow(base, d);
+
+            if (ctx.equal(y, ctx.one) || ctx.equal(y, minus))
+            {
+                return true;
+            }
+
+            for (auto i = 1zu; i < s; i++)
+            {
+                ctx.mul(y.data(), y.data(), y.data());
+
+                if (ctx.equal(y, minus))
+                {
+                    return true;
+                }
+
+                if (ctx.equal(y, ctx.one))
+                {
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+        // the strong Lucas probable prime test with the parameters of Selfridge: the first D in 5, -7, 9, -11, ...
+        // with (D / x) = -1, P = 1 and Q = (1 - D) / 4.
+        template<class Context>
+        auto strong_lucas(Context& ctx, const Nat& x) -> bool
+        {
+            auto d = std::int64_t(5);
+
+            for (auto i = 0;; i++)
+            {
+                if (const auto j = jacobi(d, x); j == -1)
+                {
+                    break;
+                }
+                else if (j == 0 && !(x.size() == 1 && x[0] == static_cast<Limb>(d < 0 ? -d : d)))
+                {
+                    return false;
+                }
+
+                // no D exists for a square, so rule it out once the search takes longer than usual.
+                if (i == 10 && is_square(BigIntAccess::fromMagnitude(x, false)))
+                {
+                    return false;
+                }
+
+                d = d < 0 ? 2 - d : -2 - d;
+            }
+
+            const auto residue_ = [&](std::int64_t k_)
+                                  {
+                                      auto ret_ = ctx.to(Nat(1, static_cast<Limb>(k_ < 0 ? -k_ : k_)));
+
+                                      if (k_ < 0)
+                                      {
+                                          auto zero_ = Nat(ctx.n);
+
+                                          ctx.sub(ret_.data(), zero_.data(), ret_.data());
+                                      }
+
+                                      return ret_;
+                                  };
+
+            const auto dm = residue_(d);
+            const auto qm = residue_((1 - d) / 4);
+
+            auto plus = x;
+
+            const auto one = Nat(1, 1);
+
+            nat_add(plus, one.data(), 1);
+
+            const auto s = nat_countr_zero(plus);
+            const auto k = nat_shr(plus, s);
+
+            auto u  = ctx.one;
+            auto v  = ctx.one;
+            auto qk = qm;
+
+            auto t1 = Nat(ctx.n);
+            auto t2 = Nat(ctx.n);
+
+            const auto doubleV_ = [&]
+                                  {
+                                      ctx.mul(v.data(), v.data(), v.data());
+                                      ctx.sub(v.data(), v.data(), qk.data());
+                                      ctx.sub(v.data(), v.data(), qk.data());
+                                      ctx.mul(qk.data(), qk.data(), qk.data());
+                                  };
+
+            for (auto i = k.size() * LimbBits - static_cast<std::size_t>(std::countl_zero(k.back())) - 1; i > 0;)
+            {
+                i--;
+
+                ctx.mul(u.data(), u.data(), v.data());
+
+                doubleV_();
+
+                if ((k[i / LimbBits] >> (i % LimbBits)) & 1)
+                {
+                    ctx.add(t1.data(), u.data(), v.data());
+                    ctx.mul(t2.data(), dm.data(), u.data());
+                    ctx.add(t2.data(), t2.data(), v.data());
+
+                    ctx.half(u.data(), t1.data());
+                    ctx.half(v.data(), t2.data());
+
+                    ctx.mul(qk.data(), qk.data(), qm.data());
+                }
+            }
+
+            if (ctx.is_zero(u) || ctx.is_zero(v))
+            {
+                return true;
+            }
+
+            for (auto i = 1zu; i < s; i++)
+            {
+                doubleV_();
+
+                if (ctx.is_zero(v))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Baillie-PSW followed by rounds of Miller-Rabin to pseudo-random bases, for an odd x with no prime
+        // factor below TrialBound.
+        template<class Context>
+        auto is_prime_candidate(Context& ctx, const Nat& x, std::size_t rounds) -> bool
+        {
+            auto minus = x;
+
+            minus[0]--;
+
+            const auto s = nat_countr_zero(minus);
+            const auto d = nat_shr(minus, s);
+
+            if (!miller_rabin(ctx, ctx.to(Nat(1, 2)), d, s) || !strong_lucas(ctx, x))
+            {
+                return false;
+            }
+
+            // the bases come from a splitmix64 sequence seeded by x, so a result never changes between runs.
+            auto state = static_cast<std::uint64_t>(hash_value(BigIntAccess::fromMagnitude(x, false)));
+
+            const auto next_ = [&]
+                               {
+                                   auto z_ = state += 0x9E3779B97F4A7C15;
+
+                                   z_ = (z_ ^ (z_ >> 30)) * 0xBF58476D1CE4E5B9;
+                                   z_ = (z_ ^ (z_ >> 27)) * 0x94D049BB133111EB;
+
+                                   return static_cast<Limb>(z_ ^ (z_ >> 31));
+                               };
+
+            auto range = x;
+
+            nat_sub(range, Nat(1, 3).data(), 1);
+
+            for (auto i = 0zu; i < rounds; i++)
+            {
+                auto random = Nat(x.size());
+
+                std::generate(random.begin(), random.end(), next_);
+
+                nat_trim(random);
+
+                auto q    = Nat();
+                auto base = Nat();
+
+                div_qr(q, base, random, range);
+
+                nat_add(base, Nat(1, 2).data(), 1);
+
+                if (!miller_rabin(ctx, ctx.to(base), d, s))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // is_prime_candidate in the context that suits x, folding for moduli of a special form.
+        inline auto is_prime_candidate(const Nat& x, std::size_t rounds) -> bool
+        {
+            if (x.size() == 1 && x[0] < TrialBound * TrialBound)
+            {
+                return true;
+            }
+
+            if (const auto form = SpecialModulus::detect(x))
+            {
+                auto ctx = SpecialModulus(x, *form);
+
+                return is_prime_candidate(ctx, x, rounds);
+            }
+
+            auto ctx = Montgomery(x);
+
+            return is_prime_candidate(ctx, x, rounds);
+        }
+
+        inline auto is_probable_prime(const Nat& x, std::size_t rounds) -> bool
+        {
+            if (x.size() == 1 && x[0] < 4)
+            {
+                return x[0] >= 2;
+            }
+
+            if (x.empty())
+            {
+                return false;
+            }
+
+            if (const auto factor = small_factor(x); factor != 0)
+            {
+                return x.size() == 1 && x[0] == factor;
+            }
+
+            return is_prime_candidate(x, rounds);
+        }
+    }
+
+    // false for composites and true for primes, with no known composite passing: Baillie-PSW is run first,
+    // and every further round of Miller-Rabin lets fewer than 1 in 4 of any remaining composites through.
+    inline static auto is_probable_prime(const akr::BigInt& value, std::size_t rounds = 0) -> bool
+    {
+        return !detail::BigIntAccess::isNegative(value) && detail::is_probable_prime(detail::BigIntAccess::magnitude(value), rounds);
+    }
+
+    // base ^ exponent mod |modulus|, in [0, |modulus|). Moduli 2^k - c and 2^k + c with a small c reduce each product
+    // by folding its high bits, other odd moduli are worked in Montgomery form, so no step divides.
+    inline static auto powmod(const akr::BigInt& base, const akr::BigInt& exponent, const akr::BigInt& modulus) -> akr::BigInt
+    {
+        if (modulus == 0)
+        {
+            throw std::invalid_argument("right operand is zero.");
+        }
+
+        if (exponent < 0)
+        {
+            throw std::invalid_argument("right operand is negative.");
+        }
+
+        U_AKR_BIGINT_COUNT_OP(PowMod, modulus.bit_length());
+
+        auto m = detail::BigIntAccess::magnitude(modulus);
+
+        const auto divisor = detail::BigIntAccess::fromMagnitude(m, false);
+
+        auto residue = base % divisor;
+
+        if (residue < 0)
+        {
+            residue += divisor;
+        }
+
+        if (const auto form = detail::SpecialModulus::detect(m))
+        {
+            auto ctx = detail::SpecialModulus(std::move(m), *form);
+
+            const auto power = ctx.pow(ctx.to(detail::BigIntAccess::magnitude(residue)), detail::BigIntAccess::magnitude(exponent));
+
+            return detail::BigIntAccess::fromMagnitude(ctx.from(power), false);
+        }
+
+        if (m[0] % 2 != 0)
+        {
+            auto ctx = detail::Montgomery(std::move(m));
+
+            const auto power = ctx.pow(ctx.to(detail::BigIntAccess::magnitude(residue)), detail::BigIntAccess::magnitude(exponent));
+
+            return detail::BigIntAccess::fromMagnitude(ctx.from(power), false);
+        }
+
+        auto ret = akr::BigInt(1) % divisor;
+
+        for (auto i = exponent.bit_length(); i > 0;)
+        {
+            i--;
+
+            ret = ret * ret % divisor;
+
+            if (exponent.test_bit(i))
+            {
+                ret = ret * residue % divisor;
+            }
+        }
+
+        return ret;
+    }
+
+    // is_probable_prime for every value, the values are spread across the task pool.
+    inline static auto are_probable_primes(std::span<const akr::BigInt> values, std::size_t rounds = 0) -> std::vector<bool>
+    {
+        auto flags = std::vector<char>(values.size());
+
+        detail::parallel_for(0, values.size(), std::max(detail::thresholds().parallel, 1zu), [&](std::size_t i_)
+                             {
+                                 flags[i_] = is_probable_prime(values[i_], rounds);
+                             });
+
+        return std::vector<bool>(flags.begin(), flags.end());
+    }
+
+    // the smallest probable prime greater than value. Odd candidates are sieved a window at a time by the trial
+    // primes, and the survivors are tested in batches across the task pool.
+    inline static auto next_prime(const akr::BigInt& value, std::size_t rounds = 0) -> akr::BigInt
+    {
+        if (value < detail::TrialBound)
+        {
+            for (auto i = value < 2 ? akr::BigInt(2) : value + 1;; i += 1)
+            {
+                if (is_probable_prime(i))
+                {
+                    return i;
+                }
+            }
+        }
+
+        constexpr auto window = 4096zu;
+
+        auto&& primes = detail::trial_primes();
+
+        auto start = detail::BigIntAccess::magnitude(value + (value.test_bit(0) ? 2 : 1));
+
+        for (;;)
+        {
+            auto isComposite = std::vector<bool>(window);
+
+            for (auto&& p : std::span(primes).subspan(1))
+            {
+                // start + 2 * i = 0 mod p when i = -start / 2 = -start * (p + 1) / 2.
+                const auto rem = detail::mod_1(start.data(), start.size(), p);
+
+                for (auto i = (p - rem) % p * ((p + 1) / 2) % p; i < window; i += p)
+                {
+                    isComposite[i] = true;
+                }
+            }
+
+            auto survivors = std::vector<std::size_t>();
+
+            for (auto i = 0zu; i < window; i++)
+            {
+                if (!isComposite[i])
+                {
+                    survivors.push_back(i);
+                }
+            }
+
+            auto&& pool = detail::task_pool();
+
+            const auto batch = pool ? pool->size() : 1zu;
+
+            for (auto first = 0zu; first < survivors.size(); first += batch)
+            {
+                const auto last = std::min(first + batch, survivors.size());
+
+                auto candidates = std::vector<detail::Nat>(last - first);
+                auto flags      = std::vector<char>(last - first);
+
+                for (auto i = first; i < last; i++)
+                {
+                    auto&& candidate = candidates[i - first] = start;
+
+                    const auto offset = detail::Nat(1, static_cast<detail::Limb>(survivors[i] * 2));
+
+                    detail::nat_add(candidate, offset.data(), offset.size());
+                }
+
+                detail::parallel_for(0, candidates.size(), std::max(detail::thresholds().parallel, 1zu), [&](std::size_t i_)
+                                     {
+                                         flags[i_] = detail::is_prime_candidate(candidates[i_], rounds);
+                                     });
+
+                for (auto i = 0zu; i < flags.size(); i++)
+                {
+                    if (flags[i])
+                    {
+                        return detail::BigIntAccess::fromMagnitude(std::move(candidates[i]), false);
+                    }
+                }
+            }
+
+            const auto step = detail::Nat(1, window * 2);
+
+            detail::nat_add(start, step.data(), step.size());
+        }
+    }
+
+    namespace detail
+    {
+        // the greatest common divisor of two magnitudes by Lehmer's algorithm: the leading bits of both decide
+        // a run of quotients, which is then applied to the whole numbers at once as a matrix of single limbs.
+        inline auto nat_gcd(Nat a, Nat b) -> Nat
+        {
+            using SLimb = std::make_signed_t<Limb>;
+
+            // the cofactors stay below 2^TopBits, so they fit a limb and the sums below cannot overflow.
+            constexpr auto TopBits = LimbBits - 2;
+
+            if (nat_cmp(a, b) < 0)
+            {
+                a.swap(b);
+            }
+
+            auto q  = Nat();
+            auto r  = Nat();
+            auto ta = Nat();
+            auto tb = Nat();
+
+            for (; b.size() > 1;)
+            {
+                const auto n = a.size();
+
+                const auto shift = n * LimbBits - static_cast<std::size_t>(std::countl_zero(a.back())) - TopBits;
+
+                const auto top_ = [&](const Nat& x_)
+                                  {
+                                      const auto i_   = shift / LimbBits;
+                                      const auto off_ = shift % LimbBits;
+
+                                      auto ret_ = i_ < x_.size() ? x_[i_] >> off_ : 0;
+
+                                      if (off_ != 0 && i_ + 1 < x_.size())
+                                      {
+                                          ret_ |= x_[i_ + 1] << (LimbBits - off_);
+                                      }
+
+                                      return static_cast<SLimb>(ret_ & ((Limb(1) << TopBits) - 1));
+                                  };
+
+                auto ah = top_(a);
+                auto bh = top_(b);
+
+                auto ma = SLimb(1);
+                auto mb = SLimb(0);
+                auto mc = SLimb(0);
+                auto md = SLimb(1);
+
+                for (; bh + mc > 0 && bh + md > 0;)
+                {
+                    const auto quotient = (ah + ma) / (bh + mc);
+
+                    if (quotient != (ah + mb) / (bh + md))
+                    {
+                        break;
+                    }
+
+                    ma = std::exchange(mc, ma - quotient * mc);
+                    mb = std::exchange(md, mb - quotient * md);
+                    ah = std::exchange(bh, ah - quotient * bh);
+                }
+
+                if (mb == 0)
+                {
+                    div_qr(q, r, a, b);
+
+                    a.swap(b);
+                    b.swap(r);
+
+                    continue;
+                }
+
+                // out = x * kx + y * ky, where the cofactors never make it negative.
+                const auto combine_ = [&](Nat& out_, SLimb kx_, SLimb ky_)
+                                      {
+                                          auto tmp_ = Nat(n + 1);
+
+                                          out_.assign(n + 1, 0);
+
+                                          out_[a.size()] = mul_1(out_.data(), a.data(), a.size(), static_cast<Limb>(kx_ < 0 ? -kx_ : kx_));
+                                          tmp_[b.size()] = mul_1(tmp_.data(), b.data(), b.size(), static_cast<Limb>(ky_ < 0 ? -ky_ : ky_));
+
+                                          if (kx_ >= 0 && ky_ >= 0)
+                                          {
+                                              add_n(out_.data(), out_.data(), tmp_.data(), n + 1);
+                                          }
+                                          else if (kx_ >= 0)
+                                          {
+                                              sub_n(out_.data(), out_.data(), tmp_.data(), n + 1);
+                                          }
+                                          else
+                                          {
+                                              sub_n(out_.data(), tmp_.data(), out_.data(), n + 1);
+                                          }
+
+                                          nat_trim(out_);
+                                      };
+
+                combine_(ta, ma, mb);
+                combine_(tb, mc, md);
+
+                a.swap(ta);
+                b.swap(tb);
+
+                if (nat_cmp(a, b) < 0)
+                {
+                    a.swap(b);
+                }
+            }
+
+            if (b.empty())
+            {
+                return a;
+            }
+
+            return Nat(1, std::gcd(b[0], mod_1(a.data(), a.size(), b[0])));
+        }
+    }
+
+    // the greatest common divisor of |lhs| and |rhs|, gcd(0, 0) is 0.
+    inline static auto gcd(const akr::BigInt& lhs, const akr::BigInt& rhs) -> akr::BigInt
+    {
+        U_AKR_BIGINT_COUNT_OP(Gcd, std::max(lhs.bit_length(), rhs.bit_length()));
+
+        return detail::BigIntAccess::fromMagnitude(detail::nat_gcd(detail::BigIntAccess::magnitude(lhs), detail::BigIntAccess::magnitude(rhs)), false);
+    }
+
+    // the least common multiple of |lhs| and |rhs|, 0 if either is 0.
+    inline static auto lcm(const akr::BigInt& lhs, const akr::BigInt& rhs) -> akr::BigInt
+    {
+        if (lhs == 0 || rhs == 0)
+        {
+            return 0;
+        }
+
+        auto ret = akr::BigInt(lhs);
+
+        ret.divexact(gcd(lhs, rhs)) *= rhs;
+
+        return ret < 0 ? -ret : ret;
+    }
+
+    namespace detail
+    {
+        // a limb of uniform bits, drawn from as many results of the generator as its range needs.
+        template<class G>
+        auto random_limb(G& urbg) -> Limb
+        {
+            using R = typename G::result_type;
+
+            constexpr auto range = static_cast<std::uintmax_t>(G::max() - G::min());
+
+            // the widest power of two range the generator covers exactly, larger results are redrawn.
+            constexpr auto bits = range == std::numeric_limits<std::uintmax_t>::max()
+                                  ? std::numeric_limits<std::uintmax_t>::digits
+                                  : std::bit_width(range + 1) - 1;
+
+            if constexpr (bits >= LimbBits)
+            {
+                return static_cast<Limb>(static_cast<R>(urbg() - G::min()));
+            }
+            else
+            {
+                auto ret = Limb(0);
+
+                for (auto filled = 0; filled < static_cast<int>(LimbBits); filled += bits)
+                {
+                    auto value = static_cast<std::uintmax_t>(urbg() - G::min());
+
+                    for (; value >> bits != 0;)
+                    {
+                        value = static_cast<std::uintmax_t>(urbg() - G::min());
+                    }
+
+                    ret |= static_cast<Limb>(value) << filled;
+                }
+
+                return ret;
+            }
+        }
+
+        template<class G>
+        auto random_nat(G& urbg, std::size_t bits) -> Nat
+        {
+            auto ret = Nat((bits + LimbBits - 1) / LimbBits);
+
+            for (auto&& e : ret)
+            {
+                e = random_limb(urbg);
+            }
+
+            if (bits % LimbBits != 0)
+            {
+                ret.back() &= (Limb(1) << bits % LimbBits) - 1;
+            }
+
+            nat_trim(ret);
+
+            return ret;
+        }
+    }
+
+    // a uniform value in [0, 2^bits), the limbs are filled straight from the generator.
+    template<class G>
+    requires(std::uniform_random_bit_generator<std::remove_reference_t<G>>)
+    inline static auto random_bits (G&& urbg, std::size_t bits) -> akr::BigInt
+    {
+        return detail::BigIntAccess::fromMagnitude(detail::random_nat(urbg, bits), false);
+    }
+
+    // a uniform value in [0, bound), drawing values of the bit length of bound - 1 until one is below bound.
+    // fewer than two draws are needed on average.
+    template<class G>
+    requires(std::uniform_random_bit_generator<std::remove_reference_t<G>>)
+    inline static auto random_below(G&& urbg, const akr::BigInt& bound) -> akr::BigInt
+    {
+        if (bound <= 0)
+        {
+            throw std::invalid_argument("bound is not positive.");
+        }
+
+        const auto limit = detail::BigIntAccess::magnitude(bound);
+
+        const auto bits = (bound - 1).bit_length();
+
+        for (;;)
+        {
+            if (auto value = detail::random_nat(urbg, bits); detail::nat_cmp(value, limit) < 0)
+            {
+                return detail::BigIntAccess::fromMagnitude(std::move(value), false);
+            }
+        }
+    }
+
+    // hands the digits of value to sink(std::string_view) in bounded pieces as they are produced, most significant first.
+    template<class F>
+    requires(std::invocable<const F&, std::string_view>)
+    inline static void write_digits(const F& sink, const akr::BigInt& value, int base = 10)
+    {
+        if (!(2 <= base && base <= 36))
+        {
+            throw std::invalid_argument("base is invalid.");
+        }
+
+        if (detail::BigIntAccess::isNegative(value))
+        {
+            sink(std::string_view("-"));
+        }
+
+        detail::write_radix(detail::BigIntAccess::magnitude(value), base, sink);
+    }
+
+    inline static void write_digits(std::ostream& os, const akr::BigInt& value, int base = 10)
+    {
+        write_digits([&os](std::string_view digits_)
+                     {
+                         os.write(digits_.data(), static_cast<std::streamsize>(digits_.size()));
+                     }, value, base);
+    }
+
+    // parses the characters of [first, last) one by one, in the syntax of the string constructor.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+    requires(std::convertible_to<std::iter_reference_t<I>, char>)
+    inline static auto read_digits(I first, S last, std::optional<int> base = std::nullopt) -> akr::BigInt
+    {
+        auto reader = detail::DigitReader(base);
+
+        for (; first != last; ++first)
+        {
+            reader.push(static_cast<char>(*first));
+        }
+
+        auto [magnitude, isNegative] = reader.finish();
+
+        return detail::BigIntAccess::fromMagnitude(std::move(magnitude), isNegative);
+    }
+
+    // parses the next whitespace delimited number of the stream, throws like the string constructor on a bad character.
+    inline static auto read_digits(std::istream& is, std::optional<int> base = std::nullopt) -> akr::BigInt
+    {
+        auto reader = detail::DigitReader(base);
+
+        is >> std::ws;
+
+        for (auto c = is.peek(); c != std::istream::traits_type::eof() && !std::isspace(static_cast<char>(c), is.getloc()); c = is.peek())
+        {
+            reader.push(static_cast<char>(is.get()));
+        }
+
+        auto [magnitude, isNegative] = reader.finish();
+
+        return detail::BigIntAccess::fromMagnitude(std::move(magnitude), isNegative);
+    }
+
+    // the threads shared by multiplication, division and radix conversion, 1 keeps everything on the calling thread.
+    // it must not be changed while another thread is computing.
+    inline static void set_thread_count(std::size_t count)
+    {
+        auto&& pool = detail::task_pool();
+
+        pool.reset();
+
+        if (count > 1)
+        {
+            pool = std::make_unique<detail::TaskPool>(count - 1);
+        }
+    }
+
+    inline static auto thread_count() noexcept -> std::size_t
+    {
+        auto&& pool = detail::task_pool();
+
+        return pool ? pool->size() : 1;
+    }
+
+    // the operand sizes, in limbs, at which the algorithms change: multiplication from schoolbook to Karatsuba at
+    // mulKaratsuba, unbalanced multiplication to Toom-3/2 and Toom-4/3 once the shorter operand reaches mulToom,
+    // division to Burnikel-Ziegler once the dividend is divRecursive limbs longer than the divisor,
+    // and radix conversion to divide and conquer at radixDivide.
+    using Thresholds = detail::Thresholds;
+
+    inline static auto thresholds() noexcept -> Thresholds
+    {
+        return detail::thresholds();
+    }
+
+    // replaces every threshold at once, e.g. to try other crossovers without rebuilding.
+    // it must not be called while another thread is computing.
+    inline static void set_thresholds(const Thresholds& values) noexcept
+    {
+        detail::thresholds() = values;
+    }
+
+    // counters of the operations, algorithms and allocations of the calling thread, kept only when D_AKR_BIGINT_STATS
+    // is defined and all zero otherwise. Work a pool thread does for this thread is counted on the pool thread.
+    using Stats = detail::Stats;
+
+    inline static auto stats() noexcept -> Stats
+    {
+        return detail::stats();
+    }
+
+    // zeroes the counters of the calling thread, the bytes it holds stay and become the new peak.
+    inline static void reset_stats() noexcept
+    {
+        auto&& s = detail::stats();
+
+        s = { .liveBytes = s.liveBytes, .peakBytes = s.liveBytes };
+    }
+
+    // the name of the limb kernels in use, chosen once for the CPU: "generic", or "bmi2-adx" on x86-64 CPUs with
+    // both extensions. The AKR_BIGINT_KERNELS environment variable names the set to use instead, if it is supported.
+    inline static auto active_kernels() noexcept -> std::string_view
+    {
+        return detail::kernels()->name;
+    }
+
+    inline static auto supported_kernels() -> std::vector<std::string_view>
+    {
+        auto ret = std::vector<std::string_view>();
+
+        for (auto&& e : detail::KernelSets)
+        {
+            if (e.isSupported())
+            {
+                ret.push_back(e.name);
+            }
+        }
+
+        return ret;
+    }
+
+    // switches to a supported set of kernels, false if there is none of that name.
+    // it must not be called while another thread is computing.
+    inline static auto set_kernels(std::string_view name) noexcept -> bool
+    {
+        for (auto&& e : detail::KernelSets)
+        {
+            if (e.name == name && e.isSupported())
+            {
+                detail::kernels() = &e;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // operands shorter than this are never split across threads.
+    inline static void set_parallel_threshold(std::size_t bits) noexcept
+    {
+        detail::thresholds().parallel = (bits + detail::LimbBits - 1) / detail::LimbBits;
+    }
+
+    inline static auto parallel_threshold() noexcept -> std::size_t
+    {
+        return detail::thresholds().parallel * detail::LimbBits;
+    }
+
+    // every BigInt and internal temporary created on this thread allocates from resource until the scope ends.
+    // values created inside must not outlive the resource, copy them out first with BigInt(value, resource).
+    // the pool only helps a scoped thread if the resource is marked thread-safe.
+    struct ResourceScope final
+    {
+        private:
+        detail::ResourceGuard guard;
+
+        public:
+        explicit ResourceScope(std::pmr::memory_resource* resource, bool isThreadSafe = false) noexcept:
+            guard({ resource, isThreadSafe })
+        {
+        }
+    };
+}
+
+namespace std
+{
+    inline static auto pow      (const akr::BigInt& lhs, const akr::BigInt& rhs) -> akr::BigInt
+    {
+        return akr::BigInt(lhs).pow_assign(rhs);
+    }
+
+    inline static auto to_string(const akr::BigInt& value) -> std::string
+    {
+        return value.ToStdString();
+    }
+}
+
+template<>
+struct std::hash<akr::BigInt>
+{
+    auto operator()(const akr::BigInt& value) const noexcept -> std::size_t
+    {
+        return akr::detail::hash_value(value);
+    }
+};
+
+// the same values as std::hash<akr::BigInt>, so a transparent hasher can probe a FrozenBigInt table with a BigInt.
+template<>
+struct std::hash<akr::FrozenBigInt>
+{
+    auto operator()(const akr::FrozenBigInt& value) const noexcept -> std::size_t
+    {
+        return value.hash();
+    }
+};
+
+#ifdef  __cpp_lib_format
+template<>
+struct std::formatter<akr::BigInt, char>
+{
+    private:
+    akr::detail::FormatSpec spec;
+
+    public:
+    constexpr auto parse(std::format_parse_context& ctx) -> std::format_parse_context::iterator
+    {
+        return spec.parse<std::format_error>(ctx.begin(), ctx.end());
+    }
+
+    template<class C>
+    auto format(const akr::BigInt& value, C& ctx) const -> typename C::iterator
+    {
+        return spec.format(value, ctx.out());
+    }
+};
+#endif//__cpp_lib_format
+
+namespace akr::literals
+{
+    // the literal is parsed at compile time, its value is built once from the parsed limbs and shared afterwards.
+    template<char... C>
+    auto operator""_akr_bigint() -> const BigInt&
+    {
+        static constexpr auto Magnitude = detail::parse_literal<C...>();
+
+        // kept out of any scoped resource, which may be released long before the value is used again.
+        static const auto value = []
+        {
+            const auto guard_ = detail::ResourceGuard({});
+
+            return BigInt::fromLimbs(std::span(Magnitude.limbs.data(), Magnitude.size), false);
+        }();
+
+        return value;
+    }
+}
+
+#ifdef  D_AKR_TEST
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace akr::test
+{
+    AKR_TEST(BigInt,
+    {
+        using namespace literals;
+
+        assert(0_akr_bigint == 0);
+        assert(BigInt(    ) == 0);
+        assert(BigInt(  0 ) == 0);
+        assert(BigInt( "0") == 0);
+        assert(BigInt("+0") == 0);
+        assert(BigInt("-0") == 0);
+
+        assert(BigInt() + 0 == 0);
+        assert(BigInt() - 0 == 0);
+        assert(BigInt() * 0 == 0);
+
+        assert(&2022_akr_bigint == &2022_akr_bigint);
+        assert(2022_akr_bigint == 2022 && -0x7E6_akr_bigint == -2022 && 03746_akr_bigint == 2022);
+        assert(0B11111100110_akr_bigint == 2022 && 0b111'1110'0110_akr_bigint == 2022 && 2'022_akr_bigint == 2022);
+        assert(123456789012345678901234567890123456789_akr_bigint == BigInt("123456789012345678901234567890123456789"));
+        assert(0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF_akr_bigint == BigInt("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", 16));
+
+        using T = std::int32_t;
+
+        auto rd = std::random_device();
+        auto re = std::mt19937_64(rd());
+
+        const auto sm = static_cast<T>(std::sqrt(std::numeric_limits<T>::max()));
+
+        auto id = std::uniform_int_distribution<T>(-sm, sm);
+
+        for (auto i = 0; i < 100; i++)
+        {
+            auto intNum = id(re);
+
+            for (; intNum == 0;)
+            {
+                intNum = id(re);
+            }
+
+            // std::printf("[%07d] num: %6d, ", i, intNum);
+
+            auto bigNum = BigInt(intNum);
+
+            assert(bigNum == intNum && bigNum == std::to_string(intNum));
+
+            for (int j = 2; j <= 36; j++)
+            {
+                auto intStr = std::string(sizeof(intNum) * 8, 0);
+
+                std::to_chars(intStr.data(), intStr.data() + intStr.size(), intNum, j);
+
+                intStr.resize(bigNum.ToStdString(j).size());
+
+                std::ranges::for_each(intStr, [](auto&& e_)
+                                    {
+                                        e_ = static_cast<char>(std::toupper(e_));
+                                    });
+
+                assert(bigNum == BigInt(intStr, j));
+
+                assert(intNum == bigNum.ToInteger<decltype(intNum)>());
+
+                assert(intStr == bigNum.ToStdString(j));
+
+                switch (j)
+                {
+                    case 0B10:
+                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0B"));
+                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0b"));
+                        break;
+                    case 010:
+                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0"));
+                        break;
+                    case 0X10:
+                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0X"));
+                        assert(bigNum == std::string(intStr).insert(intNum < 0, "0x"));
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            assert((+bigNum) == (+intNum));
+            assert((-bigNum) == (-intNum));
+            assert((~bigNum) == (~intNum));
+
+            assert((bigNum - intNum) == 0);
+            assert((bigNum / intNum) == 1);
+            assert((bigNum % intNum) == 0);
+            assert((bigNum ^ intNum) == 0);
+
+            assert(++bigNum == ++intNum);
+            assert(bigNum++ == intNum++);
+
+            assert(--bigNum == --intNum);
+            assert(bigNum-- == intNum--);
+
+            for (int j = -1; j <= 1; j++)
+            {
+                assert((j + bigNum) == (j + intNum));
+                assert((j - bigNum) == (j - intNum));
+                assert((j * bigNum) == (j * intNum));
+                assert((j / bigNum) == (j / intNum));
+                assert((j % bigNum) == (j % intNum));
+                assert((j & bigNum) == (j & intNum));
+                assert((j | bigNum) == (j | intNum));
+                assert((j ^ bigNum) == (j ^ intNum));
+
+                assert((bigNum + j) == (intNum + j));
+                assert((bigNum - j) == (intNum - j));
+                assert((bigNum * j) == (intNum * j));
+                assert((bigNum & j) == (intNum & j));
+                assert((bigNum | j) == (intNum | j));
+                assert((bigNum ^ j) == (intNum ^ j));
+            }
+
+            assert((bigNum + 2022 - intNum - 1997) == (intNum + 2022 - intNum - 1997));
+            assert((bigNum - 2022 + intNum + 1997) == (intNum - 2022 + intNum + 1997));
+            assert((bigNum - 1997 - intNum - 2022) == (intNum - 1997 - intNum - 2022));
+            assert((bigNum - 1997 + intNum + 2022) == (intNum - 1997 + intNum + 2022));
+
+            auto num1 = id(re);
+            auto num2 = id(re);
+
+            for (; num1 == 0;)
+            {
+                num1 = id(re);
+            }
+
+            for (; num2 == 0;)
+            {
+                num2 = id(re);
+            }
+
+            // std::printf("num1: %6d, num2: %6d\n", num1, num2);
+
+            assert((BigInt(num1) +  num1) == (num1 +  num1));
+            assert((BigInt(num1) -  num1) == (num1 -  num1));
+            assert((BigInt(num1) *  num1) == (num1 *  num1));
+            assert((BigInt(num1) /  num1) == (num1 /  num1));
+            assert((BigInt(num1) %  num1) == (num1 %  num1));
+            assert((BigInt(num1) &  num1) == (num1 &  num1));
+            assert((BigInt(num1) |  num1) == (num1 |  num1));
+            assert((BigInt(num1) ^  num1) == (num1 ^  num1));
+            assert((BigInt(num1) == num1) == (num1 == num1));
+            assert((BigInt(num1) != num1) == (num1 != num1));
+            assert((BigInt(num1) <  num1) == (num1 <  num1));
+            assert((BigInt(num1) >= num1) == (num1 >= num1));
+            assert((BigInt(num1) >  num1) == (num1 >  num1));
+            assert((BigInt(num1) <= num1) == (num1 <= num1));
+
+            assert((BigInt(num2) +  num2) == (num2 +  num2));
+            assert((BigInt(num2) -  num2) == (num2 -  num2));
+            assert((BigInt(num2) *  num2) == (num2 *  num2));
+            assert((BigInt(num2) /  num2) == (num2 /  num2));
+            assert((BigInt(num2) %  num2) == (num2 %  num2));
+            assert((BigInt(num2) &  num2) == (num2 &  num2));
+            assert((BigInt(num2) |  num2) == (num2 |  num2));
+            assert((BigInt(num2) ^  num2) == (num2 ^  num2));
+            assert((BigInt(num2) == num2) == (num2 == num2));
+            assert((BigInt(num2) != num2) == (num2 != num2));
             assert((BigInt(num2) <  num2) == (num2 <  num2));
             assert((BigInt(num2) >= num2) == (num2 >= num2));
             assert((BigInt(num2) >  num2) == (num2 >  num2));
             assert((BigInt(num2) <= num2) == (num2 <= num2));
 
-            assert((BigInt(num1) +  num2) == (num1 +  num2));
-            assert((BigInt(num1) -  num2) == (num1 -  num2));
-            assert((BigInt(num1) *  num2) == (num1 *  num2));
-            assert((BigInt(num1) /  num2) == (num1 /  num2));
-            assert((BigInt(num1) %  num2) == (num1 %  num2));
-            assert((BigInt(num1) &  num2) == (num1 &  num2));
-            assert((BigInt(num1) |  num2) == (num1 |  num2));
-            assert((BigInt(num1) ^  num2) == (num1 ^  num2));
-            assert((BigInt(num1) == num2) == (num1 == num2));
-            assert((BigInt(num1) != num2) == (num1 != num2));
-            assert((BigInt(num1) <  num2) == (num1 <  num2));
-            assert((BigInt(num1) >= num2) == (num1 >= num2));
-            assert((BigInt(num1) >  num2) == (num1 >  num2));
-            assert((BigInt(num1) <= num2) == (num1 <= num2));
+            assert((BigInt(num1) +  num2) == (num1 +  num2));
+            assert((BigInt(num1) -  num2) == (num1 -  num2));
+            assert((BigInt(num1) *  num2) == (num1 *  num2));
+            assert((BigInt(num1) /  num2) == (num1 /  num2));
+            assert((BigInt(num1) %  num2) == (num1 %  num2));
+            assert((BigInt(num1) &  num2) == (num1 &  num2));
+            assert((BigInt(num1) |  num2) == (num1 |  num2));
+            assert((BigInt(num1) ^  num2) == (num1 ^  num2));
+            assert((BigInt(num1) == num2) == (num1 == num2));
+            assert((BigInt(num1) != num2) == (num1 != num2));
+            assert((BigInt(num1) <  num2) == (num1 <  num2));
+            assert((BigInt(num1) >= num2) == (num1 >= num2));
+            assert((BigInt(num1) >  num2) == (num1 >  num2));
+            assert((BigInt(num1) <= num2) == (num1 <= num2));
+
+            if (i <= std::numeric_limits<decltype(num1)>::digits
+                - (std::numeric_limits<std::make_unsigned_t<decltype(num1)>>::digits
+                - (num1 > 0 ? std::countl_zero(std::bit_cast<std::make_unsigned_t<decltype(num1)>>(num1))
+                    : std::countl_one(std::bit_cast<std::make_unsigned_t<decltype(num1)>>(num1)))))
+            {
+                assert((BigInt(num1) >> i) == (num1 >> i));
+                assert((BigInt(num1) << i) == (num1 << i));
+
+                assert((BigInt(num1) << i) == (BigInt(num1) * pow(2, i)));
+
+                auto ret1 = (BigInt(num1) >> i) - (BigInt(num1) / akr::pow(2, i));
+                assert(-1 <= ret1 && ret1 <= 1);
+            }
+
+            if (i <= std::numeric_limits<decltype(num2)>::digits
+                - (std::numeric_limits<std::make_unsigned_t<decltype(num2)>>::digits
+                - (num2 > 0 ? std::countl_zero(std::bit_cast<std::make_unsigned_t<decltype(num2)>>(num2))
+                    : std::countl_one(std::bit_cast<std::make_unsigned_t<decltype(num2)>>(num2)))))
+            {
+                assert((BigInt(num2) >> i) == (num2 >> i));
+                assert((BigInt(num2) << i) == (num2 << i));
+
+                assert((BigInt(num2) << i) == (BigInt(num2) * pow(2, i)));
+
+                auto ret2 = (BigInt(num2) >> i) - (BigInt(num2) / akr::pow(2, i));
+                assert(-1 <= ret2 && ret2 <= 1);
+            }
+        }
+    });
+
+    AKR_TEST(BigIntLarge,
+    {
+        auto rd = std::random_device();
+        auto re = std::mt19937_64(rd());
+
+        const auto random = [&](std::size_t bits_)
+        {
+            return random_bits(re, bits_ / 4 * 4).set_bit(bits_ / 4 * 4);
+        };
+
+        for (auto bits = 64zu; bits <= 200000; bits *= 5)
+        {
+            const auto a = random(bits);
+            const auto b = random(bits / 3 + 1);
+            const auto r = random(bits / 5) % b;
+
+            const auto c = a * b + r;
+
+            assert(c / b == a && c % b == r);
+            assert((-c) / b == -a && (-c) % b == -r);
+            assert(BigInt(c.ToStdString()) == c && BigInt(c.ToStdString(7), 7) == c && BigInt(c.ToStdString(16), 16) == c);
+
+            set_thread_count(4);
+            set_parallel_threshold(0);
+
+            assert(a * c == c * a && (a * c) / c == a && BigInt((a * c).ToStdString()) == a * c);
+            assert((a * a).ToStdString() == (a * a).ToStdString(10) && BigInt((a * a).ToStdString()) == a * a);
+
+            set_thread_count(1);
+            set_parallel_threshold(1024 * 64);
+        }
+
+        assert((BigInt(1) << 64).ToStdString() == "18446744073709551616");
+        assert((BigInt(10) * BigInt("10000000000000000000")).ToStdString() == "100000000000000000000");
+        assert(BigInt("-9223372036854775808").ToInteger<std::int64_t>() == std::numeric_limits<std::int64_t>::min());
+
+        try
+        {
+            static_cast<void>(BigInt("-9223372036854775809").ToInteger<std::int64_t>());
+            assert(false);
+        }
+        catch (const std::out_of_range&)
+        {
+        }
+    });
+
+    AKR_TEST(BigIntProduct,
+    {
+        auto fact = BigInt(1);
+
+        for (auto i = 0zu; i <= 1000; i++)
+        {
+            fact *= std::max(i, 1zu);
+
+            if (i <= 40 || i % 97 == 0)
+            {
+                assert(factorial(i) == fact);
+            }
+        }
+
+        assert(factorial(1000) / factorial(600) / factorial(400) == binomial(1000, 400));
+        assert(binomial(100, 50) == BigInt("100891344545564193334812497256"));
+        assert(binomial(5, 0) == 1 && binomial(5, 5) == 1 && binomial(5, 6) == 0 && binomial(0, 0) == 1);
+
+        assert(primorial(1) == 1 && primorial(2) == 2 && primorial(30) == 6469693230);
+
+        const auto nums = std::vector<int>({ -3, 5, -7, 11, std::numeric_limits<int>::min() });
+
+        assert(product(nums) == BigInt(-3) * 5 * -7 * 11 * std::numeric_limits<int>::min());
+        assert(product(std::vector<BigInt>()) == 1);
+        assert(product(std::vector<BigInt>(3, -factorial(30))) == -factorial(30) * factorial(30) * factorial(30));
+
+        set_thread_count(3);
+        set_parallel_threshold(0);
+
+        assert(factorial(3000) == factorial(2999) * 3000);
+
+        set_thread_count(1);
+        set_parallel_threshold(1024 * 64);
+    });
+
+    AKR_TEST(BigIntBatch,
+    {
+        auto values = std::vector<BigInt>();
+
+        for (auto i = 0; i < 300; i++)
+        {
+            auto e = pow(BigInt(-7), i % 90) - (i % 5 == 0 ? 0 : 1) + (i % 7 == 0 ? std::numeric_limits<std::int64_t>::min() : 0);
+
+            values.push_back(i % 3 == 0 ? -e : e);
+        }
+
+        auto total = BigInt(0);
+
+        for (auto&& e : values)
+        {
+            total += e;
+        }
+
+        assert(sum(values) == total && sum(std::vector<BigInt>()) == 0);
+        assert(sum(std::vector<BigInt>(5, -1)) == -5 && sum(std::vector<BigInt>(3, std::numeric_limits<std::int64_t>::min())) == BigInt(std::numeric_limits<std::int64_t>::min()) * 3);
+
+        for (auto threads = 1zu; threads <= 4; threads += 3)
+        {
+            set_thread_count(threads);
+            set_parallel_threshold(0);
+
+            assert(sum(values) == total);
+
+            auto out = std::vector<BigInt>(values.size());
+
+            add(out, values, values);
+
+            for (auto i = 0zu; i < values.size(); i++)
+            {
+                assert(out[i] == values[i] * 2);
+            }
+
+            mul(out, out, values);
+
+            for (auto i = 0zu; i < values.size(); i++)
+            {
+                assert(out[i] == values[i] * values[i] * 2);
+            }
+
+            mod(out, out, BigInt(1000003));
+
+            for (auto i = 0zu; i < values.size(); i++)
+            {
+                assert(out[i] == values[i] * values[i] * 2 % 1000003);
+            }
+
+            out = values;
+
+            add(out, std::vector<BigInt>(values.size(), 1), out);
+            mul(out, out, -3);
+
+            for (auto i = 0zu; i < values.size(); i++)
+            {
+                assert(out[i] == (values[i] + 1) * -3);
+            }
+
+            out = values;
+
+            mul(out, out, out[0]);
+            add(out, out, out.back());
+
+            for (auto i = 0zu; i < values.size(); i++)
+            {
+                assert(out[i] == values[i] * values[0] + values.back() * values[0]);
+            }
+
+            const auto strs = to_strings(values, 36);
+
+            auto views = std::vector<std::string_view>();
+
+            for (auto&& e : strs)
+            {
+                views.push_back(e);
+            }
+
+            assert(from_strings(views, 36) == values);
+
+            auto isThrown = false;
+
+            try
+            {
+                mod(out, values, std::vector<BigInt>(values.size()));
+            }
+            catch (const std::invalid_argument&)
+            {
+                isThrown = true;
+            }
+
+            assert(isThrown);
+        }
+
+        set_thread_count(1);
+        set_parallel_threshold(1024 * 64);
+    });
+
+    inline constexpr const char* BadFormats[] = { "q", "10q", "<<<", "{<5" };
+
+    inline constexpr const char* BadDigits[] = { "", "-", "0b", "12a", "0x", "08", "+-" };
+
+    AKR_TEST(BigIntAccumulator,
+    {
+        auto re = std::mt19937_64(2022);
+
+        auto acc = BigIntAccumulator();
+        auto sum = BigInt();
+
+        assert(acc.value() == 0);
+
+        for (auto i = 0; i < 3000; i++)
+        {
+            const auto x = random_bits(re, re() % (i % 100 == 0 ? 20000 : 700)) * (re() % 2 == 0 ? -1 : 1);
+
+            if (i % 3 == 0)
+            {
+                acc -= x;
+                sum -= x;
+            }
+            else
+            {
+                acc += x;
+                sum += x;
+            }
+
+            if (i % 500 == 0)
+            {
+                assert(acc.value() == sum);
+            }
+        }
+
+        assert(acc.value() == sum);
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            acc += std::numeric_limits<std::int64_t>::min();
+            acc -= std::numeric_limits<std::uint64_t>::max();
+            acc += -1;
+        }
+
+        assert(acc.value() == sum - (BigInt(std::numeric_limits<std::int64_t>::min()) * -1 + std::numeric_limits<std::uint64_t>::max() + 1) * 1000);
+
+        acc.clear();
+
+        assert(acc.value() == 0);
+
+        acc -= BigInt(1) << 5000;
+        acc += 1;
+
+        assert(acc.value() == 1 - (BigInt(1) << 5000));
+
+        acc += (BigInt(1) << 5000) * 2;
+
+        assert(acc.value() == (BigInt(1) << 5000) + 1);
+    });
+
+    AKR_TEST(BigIntStream,
+    {
+        auto values = std::vector<BigInt>();
+
+        for (auto i = 0; i < 30; i++)
+        {
+            values.push_back(pow(BigInt(i % 2 == 0 ? 10 : -7), i * i * 7) - (i % 3 == 0 ? 0 : 1));
+        }
+
+        values.push_back(0);
+        values.push_back(-1);
+
+        auto text = std::string();
+
+        for (auto&& e : values)
+        {
+            for (auto base = 2; base <= 36; base += 7)
+            {
+                auto streamed = std::string();
+
+                auto pieces = 0zu;
+
+                write_digits([&](std::string_view digits_)
+                             {
+                                 assert(!digits_.empty() && digits_.size() <= 1zu << 14);
+
+                                 streamed += digits_;
+
+                                 pieces++;
+                             }, e, base);
+
+                assert(streamed == e.ToStdString(base));
+                assert(pieces <= streamed.size() / (1zu << 14) + 2);
+                assert(read_digits(streamed.begin(), streamed.end(), base) == e);
+            }
+
+            auto os = std::ostringstream();
+
+            os << e;
+
+            assert(os.str() == e.ToStdString());
+
+            text += os.str() + (text.size() % 2 == 0 ? "\n" : "  ");
+        }
+
+        auto is = std::istringstream(text + " 0x1F -0b101 017");
+
+        for (auto&& e : values)
+        {
+            auto value = BigInt(12345);
+
+            is >> value;
+
+            assert(is && value == e);
+        }
+
+        assert(read_digits(is) == 31 && read_digits(is) == -5);
+
+        auto value = BigInt();
+
+        assert(is >> value && value == 15 && !(is >> value) && value == 15);
+
+        const auto hexText = std::string("-0x7fffFFFFffffFFFFffff");
+
+        assert(read_digits(hexText.begin(), hexText.end()) == BigInt(hexText));
+
+        auto os = std::ostringstream();
+
+        os << std::setw(6) << std::setfill('*') << BigInt(-42);
+
+        assert(os.str() == "***-42");
+
+        auto isThrown = 0;
+
+        for (auto bad : BadDigits)
+        {
+            try
+            {
+                const auto badText = std::string(bad);
+
+                read_digits(badText.begin(), badText.end());
+            }
+            catch (const std::invalid_argument&)
+            {
+                isThrown++;
+            }
+        }
+
+        const auto zeroText = std::string("0");
+
+        assert(isThrown == 7 && read_digits(zeroText.begin(), zeroText.end()) == 0);
+    });
+
+    AKR_TEST(BigIntChars,
+    {
+        const auto lower = [](std::string str_)
+        {
+            std::ranges::transform(str_, str_.begin(), detail::to_lower);
+
+            return str_;
+        };
+
+        auto buffer = std::vector<char>(40000);
+
+        for (auto i = 0; i < 60; i++)
+        {
+            const auto value = pow(BigInt(i % 2 == 0 ? 3 : -3), i * i * 3) - i % 4;
+
+            for (auto base = 2; base <= 36; base += 5)
+            {
+                const auto expect = lower(value.ToStdString(base));
+
+                const auto written = to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+
+                assert(written.ec == std::errc() && std::string_view(buffer.data(), written.ptr) == expect);
+
+                const auto tooShort = to_chars(buffer.data(), buffer.data() + expect.size() - 1, value, base);
+
+                assert(tooShort.ec == std::errc::value_too_large && tooShort.ptr == buffer.data() + expect.size() - 1);
+
+                auto parsed = BigInt(7);
+
+                const auto result = from_chars(expect.data(), expect.data() + expect.size(), parsed, base);
+
+                assert(result.ec == std::errc() && result.ptr == expect.data() + expect.size() && parsed == value);
+            }
+        }
+
+        const auto text = std::string_view("-123abc+");
+
+        auto parsed = BigInt(7);
+
+        assert(from_chars(text.data(), text.data() + text.size(), parsed).ptr == text.data() + 4 && parsed == -123);
+        assert(from_chars(text.data(), text.data() + text.size(), parsed, 16).ptr == text.data() + 7 && parsed == -0x123ABC);
+        assert(from_chars(text.data() + 7, text.data() + text.size(), parsed).ec == std::errc::invalid_argument && parsed == -0x123ABC);
+        assert(from_chars(text.data(), text.data() + 1, parsed).ec == std::errc::invalid_argument);
+
+        const auto formatted = [](std::string_view spec_, const BigInt& value_)
+        {
+            auto format_ = detail::FormatSpec {};
+
+            assert(format_.parse<std::invalid_argument>(spec_.begin(), spec_.end()) == spec_.end());
+
+            auto str_ = std::string();
+
+            format_.format(value_, std::back_inserter(str_));
+
+            return str_;
+        };
+
+        assert(formatted("", 255) == "255" && formatted("x", 255) == "ff" && formatted("#X", 255) == "0XFF");
+        assert(formatted("#b", 5) == "0b101" && formatted("o", 8) == "10" && formatted("#o", 0) == "0");
+        assert(formatted(">8", -42) == "     -42" && formatted("*<6", 42) == "42****" && formatted("*^7", 42) == "**42***");
+        assert(formatted("+", 42) == "+42" && formatted(" ", 42) == " 42" && formatted("+", -42) == "-42");
+        assert(formatted("08", -42) == "-0000042" && formatted("#010x", 255) == "0x000000ff" && formatted("5", 123456) == "123456");
+        assert(formatted(",", 1234567) == "1,234,567" && formatted("_x", 0xABCDEF) == "ab_cdef" && formatted("'d", -1000) == "-1'000");
+        assert(formatted(",", 100) == "100" && formatted(",", 0) == "0");
+
+        const auto rest = std::string_view("}>");
+
+        auto empty = detail::FormatSpec {};
+
+        assert(empty.parse<std::invalid_argument>(rest.begin(), rest.end()) == rest.begin() && empty.fill == ' ' && empty.align == '\0');
+
+        const auto large = pow(BigInt(-3), 5000);
+
+        auto grouped = formatted(",", large);
+
+        std::erase(grouped, ',');
+
+        assert(grouped == large.ToStdString() && formatted("X", large) == large.ToStdString(16));
+
+        auto isThrown = 0;
+
+        for (auto bad : BadFormats)
+        {
+            try
+            {
+                const auto spec = std::string_view(bad);
+
+                auto format = detail::FormatSpec {};
+
+                format.parse<std::invalid_argument>(spec.begin(), spec.end());
+            }
+            catch (const std::invalid_argument&)
+            {
+                isThrown++;
+            }
+        }
+
+        assert(isThrown == 4);
+    });
+
+    using BigIntIndex = std::unordered_map<BigInt, int>;
+
+    AKR_TEST(BigIntHash,
+    {
+        auto hashes = std::unordered_set<std::size_t>();
+
+        auto values = BigIntIndex();
+
+        for (auto i = -500; i <= 500; i++)
+        {
+            const auto value = BigInt(i) << (i < 0 ? -i : i);
+
+            hashes.insert(std::hash<BigInt>()(value));
+
+            values[value] = i;
+
+            assert(std::hash<BigInt>()(value) == std::hash<BigInt>()(BigInt(value.ToStdString())));
+            assert(std::hash<BigInt>()(value) == std::hash<FrozenBigInt>()(FrozenBigInt(value)));
+        }
+
+        assert(hashes.size() == 1001 && values.size() == 1001 && values[BigInt(-7) << 7] == -7);
+        assert(std::hash<BigInt>()(0) != std::hash<BigInt>()(-1));
+
+        const auto frozen = FrozenBigInt(pow(BigInt(-3), 1000));
+
+        const auto copy = frozen;
+
+        assert(&frozen.ToStdString() == &copy.ToStdString() && frozen.ToStdString() == pow(BigInt(-3), 1000).ToStdString());
+        assert(frozen.hash() == copy.hash() && frozen == copy && frozen == FrozenBigInt(pow(BigInt(3), 1000)));
+        assert(frozen != FrozenBigInt() && FrozenBigInt().value() == 0 && static_cast<const BigInt&>(frozen) > 0);
+
+        auto os = std::ostringstream();
+
+        os << frozen;
+
+        assert(os.str() == frozen.ToStdString());
+    });
+
+    AKR_TEST(BigIntBits,
+    {
+        for (auto i = -300; i <= 300; i += 7)
+        {
+            const auto value = (BigInt(i) << (i < 0 ? -i : i)) + i * 12345;
+
+            const auto bits = value.ToStdString(2);
+
+            auto count = 0zu;
+
+            for (auto j = 0zu; j < value.bit_length() + 70; j++)
+            {
+                const auto bit = (value >> j) % 2 != 0;
+
+                assert(value.test_bit(j) == bit);
+
+                count += j < value.bit_length() && bit != (value < 0) ? 1 : 0;
+
+                const auto mask = BigInt(1) << j;
+
+                assert(BigInt(value).set_bit(j) == (value | mask) && BigInt(value).clear_bit(j) == (value & ~mask));
+                assert(BigInt(value).flip_bit(j) == (value ^ mask));
+
+                const auto next = value.next_set_bit(j);
+
+                if (next != std::numeric_limits<std::size_t>::max())
+                {
+                    assert(next >= j && value.test_bit(next) && (value & ((BigInt(1) << next) - 1) >> j << j) == 0);
+                }
+                else
+                {
+                    assert(value >= 0 && (value >> j) == 0);
+                }
+            }
+
+            assert(value.popcount() == count);
+            assert(value.bit_length() == (value < 0 ? ~value : value).ToStdString(2).size() - (value == 0 || value == -1 ? 1 : 0));
+
+            if (value != 0)
+            {
+                assert(value.countr_zero() == value.next_set_bit(0) && (value >> value.countr_zero()) % 2 != 0);
+                assert(value.countr_zero() == (-value).countr_zero());
+            }
+        }
+
+        assert(BigInt(0).countr_zero() == std::numeric_limits<std::size_t>::max() && BigInt(-1).countr_zero() == 0);
+        assert(BigInt(-1).bit_length() == 0 && BigInt(-1).popcount() == 0 && BigInt(-8).bit_length() == 3 && BigInt(-8).popcount() == 3);
+        assert(BigInt(-1).clear_bit(100) == -(BigInt(1) << 100) - 1 && BigInt(0).set_bit(100) == BigInt(1) << 100);
+        assert(BigInt(5).clear_bit(2).clear_bit(0) == 0 && BigInt(-5).set_bit(2) == -1);
+    });
+
+    inline constexpr detail::Limb LucasPseudoprimes[] = { 5459, 5777, 10877, 16109, 18971, 22499, 24569, 25199, 40309, 58519 };
+
+    AKR_TEST(BigIntPrime,
+    {
+        for (auto i = -10; i < 20000; i++)
+        {
+            auto isPrime = i >= 2;
+
+            for (auto j = 2; j * j <= i && isPrime; j++)
+            {
+                isPrime = i % j != 0;
+            }
+
+            assert(is_probable_prime(i) == isPrime);
+
+            if (i < 5000)
+            {
+                auto next = std::max(i + 1, 2);
+
+                for (; !is_probable_prime(next); next++)
+                {
+                }
+
+                assert(next_prime(i) == next);
+            }
+        }
+
+        // each passes the strong Lucas test but not Miller-Rabin to base 2, and the opposite for the last one.
+        for (auto&& e : LucasPseudoprimes)
+        {
+            auto ctx = detail::Montgomery(detail::Nat(1, e));
+
+            const auto d = detail::nat_shr(detail::Nat(1, e - 1), std::countr_zero(e - 1));
+
+            assert(detail::strong_lucas(ctx, ctx.modulus) && !detail::miller_rabin(ctx, ctx.to(detail::Nat(1, 2)), d, std::countr_zero(e - 1)));
+        }
+
+        assert(!is_probable_prime(BigInt("3825123056546413051")) && !is_probable_prime(BigInt("3825123056546413051"), 8));
+        assert(!is_probable_prime((BigInt(1) << 128) + 1) && !is_probable_prime(BigInt("18446744073709551557") * BigInt("18446744073709551533")));
+
+        for (auto&& e : { 61, 89, 127, 521, 607, 1279, 2203 })
+        {
+            const auto mersenne = (BigInt(1) << e) - 1;
+
+            assert(is_probable_prime(mersenne, 4) && !is_probable_prime(mersenne + 2) && !is_probable_prime(-mersenne));
+            assert(next_prime(mersenne - 2) == mersenne);
+        }
+
+        assert(next_prime(BigInt("100000000000000000000")) == BigInt("100000000000000000039"));
+        assert(next_prime((BigInt(1) << 64) - 59) == (BigInt(1) << 64) + 13);
+
+        for (auto i = 0; i < 40; i++)
+        {
+            const auto base     = pow(BigInt(i % 2 == 0 ? 7 : -7), i * 9) + i;
+            const auto exponent = pow(BigInt(3), i * 5) + i;
+            const auto modulus  = pow(BigInt(i % 3 == 0 ? -10 : 10), i * 2) + i % 2;
+
+            auto expected = modulus == 1 || modulus == -1 ? BigInt(0) : BigInt(1);
+
+            for (auto j = exponent.bit_length(); j > 0;)
+            {
+                j--;
+
+                expected = expected * expected % modulus;
+
+                if (exponent.test_bit(j))
+                {
+                    expected = expected * base % modulus;
+                }
+            }
+
+            expected = (expected % modulus + (modulus < 0 ? -modulus : modulus)) % modulus;
+
+            assert(powmod(base, exponent, modulus) == expected);
+        }
+
+        auto candidates = std::vector<BigInt>();
+
+        for (auto i = 0; i < 64; i++)
+        {
+            candidates.push_back((BigInt(1) << 200) + i);
+        }
+
+        set_thread_count(3);
+
+        const auto flags = are_probable_primes(candidates, 2);
+
+        set_thread_count(1);
+
+        for (auto i = 0zu; i < candidates.size(); i++)
+        {
+            assert(flags[i] == is_probable_prime(candidates[i]));
+            assert(!flags[i] || next_prime(candidates[0] - 1) <= candidates[i]);
+        }
+    });
+
+    AKR_TEST(BigIntThresholds,
+    {
+        const auto saved = thresholds();
+
+        auto re = std::mt19937_64(2022);
+
+        const auto a = random_bits(re, 9000) + 1;
+        const auto b = random_bits(re, 4000) + 1;
+
+        const auto product  = a * b;
+        const auto quotient = product / (b + 1);
+        const auto digits   = product.ToStdString();
+
+        for (auto limbs = 1zu; limbs < 100; limbs = limbs * 3 + 1)
+        {
+            auto values = saved;
+
+            values.mulKaratsuba = limbs;
+            values.mulToom      = limbs;
+            values.divRecursive = limbs;
+            values.radixDivide  = limbs;
+
+            set_thresholds(values);
+
+            assert(thresholds().mulKaratsuba == limbs && thresholds().radixDivide == limbs);
+            assert(a * b == product && product / (b + 1) == quotient && product.ToStdString() == digits && BigInt(digits) == product);
+
+            auto stream = std::ostringstream();
+
+            stream << product;
+
+            assert(stream.str() == digits);
+        }
+
+        set_thresholds(saved);
+
+        assert(thresholds().mulKaratsuba == D_AKR_BIGINT_MUL_KARATSUBA && thresholds().divRecursive == D_AKR_BIGINT_DIV_RECURSIVE);
+    });
+
+    AKR_TEST(BigIntUnbalanced,
+    {
+        const auto saved = thresholds();
+
+        auto re = std::mt19937_64(2022);
+
+        auto schoolbook = saved;
+        auto toom       = saved;
+
+        schoolbook.mulKaratsuba = std::numeric_limits<std::size_t>::max();
+
+        toom.mulKaratsuba = 4;
+        toom.mulToom      = 16;
+
+        for (auto i = 0; i < 300; i++)
+        {
+            const auto bits = 16 * detail::LimbBits + re() % (200 * detail::LimbBits);
+
+            auto a = random_bits(re, bits * (100 + re() % 120) / 100);
+            auto b = random_bits(re, bits);
+
+            a = i % 3 == 0 ? (BigInt(1) << a.bit_length()) - 1 : a;
+            b = i % 5 == 0 ? -b : b;
+
+            set_thresholds(schoolbook);
+
+            const auto expect = a * b;
+
+            set_thresholds(toom);
+
+            assert(a * b == expect && b * a == expect);
+        }
+
+        set_thresholds(saved);
+
+        assert(pow(BigInt(7), 5000) * 13 == pow(BigInt(7), 5000) * BigInt(13));
+    });
+
+    AKR_TEST(BigIntDivExact,
+    {
+        auto re = std::mt19937_64(2022);
+
+        for (auto i = 0; i < 300; i++)
+        {
+            auto a = random_bits(re, re() % (120 * detail::LimbBits));
+            auto b = random_bits(re, 1 + re() % (120 * detail::LimbBits)) + 1;
+
+            a = i % 3 == 0 ? -a : a;
+            b = i % 4 == 0 ? -b << static_cast<std::size_t>(re() % 200) : b;
+
+            auto product = a * b;
+
+            assert(product.divexact(b) == a && BigInt(a * b).divexact(a == 0 ? b : a) == (a == 0 ? 0 : b));
+        }
+
+        const auto large = random_bits(re, 300 * detail::LimbBits);
+
+        assert(BigInt(large * (large + 1)).divexact(large + 1) == large);
+
+        assert(lcm(BigInt(4) << 300, BigInt(-6) << 200) == BigInt(12) << 300 && lcm(BigInt(21), 6) == 42);
+
+        for (auto i = 0; i < 300; i++)
+        {
+            auto d = i % 3 == 0 ? BigInt(re() >> (re() % 64)) + 1 : random_bits(re, 1 + re() % (60 * detail::LimbBits)) + 1;
+
+            d = i % 5 == 0 ? -d : i % 7 == 0 ? pow(BigInt(10), 19) : d;
+
+            const auto x = random_bits(re, re() % (150 * detail::LimbBits)) * (i % 2 == 0 ? 1 : -1);
+
+            const auto divisor = Divisor(d);
+
+            auto q = x;
+            auto r = BigInt();
+
+            divmod(q, r, q, divisor);
+
+            assert(x / divisor == x / d && x % divisor == x % d && q == x / d && r == x % d && divisor.value() == d);
+        }
+
+        auto x = pow(BigInt(10), 400) + 7;
+
+        x /= Divisor(pow(BigInt(10), 19));
+
+        assert(x == pow(BigInt(10), 381) && (x %= Divisor(BigInt(3))) == 1);
+
+        try { Divisor(BigInt(0)); assert(false); } catch (const std::invalid_argument&) {}
+        try { x.divexact(0);      assert(false); } catch (const std::invalid_argument&) {}
+    });
+
+    AKR_TEST(BigIntSpecialModulus,
+    {
+        auto re = std::mt19937_64(2022);
+
+        for (auto i = 0; i < 400; i++)
+        {
+            const auto k = detail::LimbBits + re() % (12 * detail::LimbBits);
+            const auto c = BigInt(i % 4 == 0 ? re() % 3 : re() >> 32);
+
+            const auto m = i % 2 == 0 ? (BigInt(1) << k) + c : (BigInt(1) << k) - c - (c == 0 ? 1 : 0);
+
+            auto x = random_bits(re, re() % (k * 3)) * (i % 3 == 0 ? -1 : 1);
+
+            x = i % 5 == 0 ? m * random_bits(re, k) - (i % 10 == 0 ? 1 : 0) : x;
+
+            const auto r = x - x / m * m;
+
+            auto y = x;
+
+            assert((y %= m) == r && x % Divisor(m) == r);
+
+            if (i % 20 == 0)
+            {
+                const auto e = random_bits(re, 300);
+
+                auto expect = BigInt(1);
+
+                for (auto j = e.bit_length(); j > 0;)
+                {
+                    j--;
+
+                    expect = expect * expect % m;
+                    expect = e.test_bit(j) ? expect * x % m : expect;
+                }
+
+                assert(powmod(x, e, m) == (expect < 0 ? expect + m : expect));
+            }
+        }
+
+        assert(is_probable_prime((BigInt(1) << 521) - 1) && is_probable_prime((BigInt(1) << 607) - 1) && !is_probable_prime((BigInt(1) << 523) - 1));
+        assert(is_probable_prime((BigInt(1) << 414) - 17) && !is_probable_prime((BigInt(1) << 512) + 1));
+        assert(powmod(3, (BigInt(1) << 1279) - 2, (BigInt(1) << 1279) - 1) == 1);
+    });
+
+    #ifdef  D_AKR_BIGINT_STATS
+    AKR_TEST(BigIntStats,
+    {
+        auto re = std::mt19937_64(2022);
+
+        const auto a = random_bits(re, 20000) + 1;
+        const auto b = random_bits(re, 20000) + 1;
+
+        reset_stats();
 
-            if (i <= std::numeric_limits<decltype(num1)>::digits
-                - (std::numeric_limits<std::make_unsigned_t<decltype(num1)>>::digits
-                - (num1 > 0 ? std::countl_zero(std::bit_cast<std::make_unsigned_t<decltype(num1)>>(num1))
-                    : std::countl_one(std::bit_cast<std::make_unsigned_t<decltype(num1)>>(num1)))))
+        const auto live = stats().liveBytes;
+
+        const auto product = a * b;
+        const auto digits  = product.ToStdString();
+
+        assert(product / b == a && BigInt(digits) == product && gcd(product, a) == a);
+
+        const auto s = stats();
+
+        assert(s.calls[Stats::Mul] >= 1 && s.calls[Stats::Div] == 1 && s.calls[Stats::Print] == 1 && s.calls[Stats::Parse] == 1);
+        assert(s.sizes[Stats::Mul][std::bit_width(std::max(a.bit_length(), b.bit_length()))] >= 1);
+        assert(s.sizes[Stats::Print][std::bit_width(product.bit_length())] == 1);
+        assert(s.tiers[Stats::MulKaratsuba] >= 1 && s.tiers[Stats::MulBasecase] > s.tiers[Stats::MulKaratsuba]);
+        assert(s.tiers[Stats::DivRecursive] >= 1 && s.tiers[Stats::RadixDivide] >= 1);
+        assert(s.allocations >= s.deallocations && s.allocatedBytes >= product.bit_length() / 8);
+        assert(s.peakBytes >= s.liveBytes && s.peakBytes >= live + static_cast<std::int64_t>(product.bit_length() / 8));
+
+        reset_stats();
+
+        assert(stats().calls[Stats::Mul] == 0 && stats().tiers[Stats::MulBasecase] == 0 && stats().peakBytes == stats().liveBytes);
+
+        std::thread([]
+                    {
+                        assert(stats().allocations == 0);
+                    }).join();
+    });
+    #else
+    AKR_TEST(BigIntStats,
+    {
+        const auto product = pow(BigInt(3), BigInt(1000)) * pow(BigInt(5), BigInt(1000));
+
+        assert(product % 15 == 0 && stats().calls[Stats::Mul] == 0 && stats().allocations == 0 && stats().peakBytes == 0);
+    });
+    #endif//D_AKR_BIGINT_STATS
+
+    AKR_TEST(BigIntKernels,
+    {
+        const auto initial = active_kernels();
+
+        auto re = std::mt19937_64(2022);
+
+        const auto fill_ = [&](std::vector<detail::Limb>& limbs_)
+        {
+            for (auto&& e_ : limbs_)
             {
-                assert((BigInt(num1) >> i) == (num1 >> i));
-                assert((BigInt(num1) << i) == (num1 << i));
+                e_ = re() % 4 == 0 ? ~detail::Limb(0) : re() % 3 == 0 ? 0 : re();
+            }
+        };
 
-                assert((BigInt(num1) << i) == (BigInt(num1) * pow(2, i)));
+        for (auto&& kernels : detail::KernelSets)
+        {
+            if (!kernels.isSupported())
+            {
+                continue;
+            }
 
-                auto ret1 = (BigInt(num1) >> i) - (BigInt(num1) / akr::pow(2, i));
-                assert(-1 <= ret1 && ret1 <= 1);
+            assert(set_kernels(kernels.name) && active_kernels() == kernels.name);
+
+            for (auto n = 0zu; n < 70; n++)
+            {
+                auto a = std::vector<detail::Limb>(n);
+                auto b = std::vector<detail::Limb>(n);
+                auto r = std::vector<detail::Limb>(n);
+
+                fill_(a);
+                fill_(b);
+                fill_(r);
+
+                const auto limb = n % 5 == 0 ? ~detail::Limb(0) : static_cast<detail::Limb>(re());
+                const auto bits = 1 + n % (detail::LimbBits - 1);
+
+                for (auto op = 0; op < 7; op++)
+                {
+                    auto expected = r;
+                    auto actual   = r;
+
+                    const auto apply_ = [&](auto&& k_, std::vector<detail::Limb>& out_)
+                    {
+                        switch (op)
+                        {
+                        case 0: return k_.addN   (out_.data(), a.data(), b.data(), n);
+                        case 1: return k_.subN   (out_.data(), a.data(), b.data(), n);
+                        case 2: return k_.mul1   (out_.data(), a.data(), n, limb);
+                        case 3: return k_.addmul1(out_.data(), a.data(), n, limb);
+                        case 4: return k_.submul1(out_.data(), a.data(), n, limb);
+                        case 5: return k_.lshift (out_.data(), a.data(), n, bits);
+                        default:
+                            return k_.rshift (out_.data(), a.data(), n, bits);
+                        }
+                    };
+
+                    assert(apply_(detail::KernelSets[0], expected) == apply_(kernels, actual) && expected == actual);
+                }
+
+                auto aliased  = a;
+                auto expected = a;
+
+                assert(kernels.addN(aliased.data(), aliased.data(), b.data(), n) == detail::generic::add_n(expected.data(), expected.data(), b.data(), n) && aliased == expected);
             }
 
-            if (i <= std::numeric_limits<decltype(num2)>::digits
-                - (std::numeric_limits<std::make_unsigned_t<decltype(num2)>>::digits
-                - (num2 > 0 ? std::countl_zero(std::bit_cast<std::make_unsigned_t<decltype(num2)>>(num2))
-                    : std::countl_one(std::bit_cast<std::make_unsigned_t<decltype(num2)>>(num2)))))
+            const auto x = random_bits(re, 5000) + 1;
+            const auto y = random_bits(re, 3000) + 1;
+
+            assert((x * y) / y == x && (x * y) % x == 0 && ((x << 77) >> 77) == x && x * y - y * x == 0);
+        }
+
+        assert(!set_kernels("none") && set_kernels(initial) && active_kernels() == initial);
+        assert(supported_kernels().front() == "generic");
+    });
+
+    AKR_TEST(BigIntGcd,
+    {
+        auto re = std::mt19937_64(2022);
+
+        for (auto i = 0zu; i < 2000; i++)
+        {
+            const auto common = random_bits(re, i % 300) + 1;
+
+            const auto a = random_bits(re, i * 7 % 1500) * common;
+            const auto b = random_bits(re, i * 13 % 900) * common * (i % 3 == 0 ? -1 : 1);
+
+            auto x = a < 0 ? -a : a;
+            auto y = b < 0 ? -b : b;
+
+            for (; y != 0;)
             {
-                assert((BigInt(num2) >> i) == (num2 >> i));
-                assert((BigInt(num2) << i) == (num2 << i));
+                x = std::exchange(y, x % y);
+            }
 
-                assert((BigInt(num2) << i) == (BigInt(num2) * pow(2, i)));
+            assert(gcd(a, b) == x && gcd(b, a) == x && gcd(a, 0) == (a < 0 ? -a : a));
+            assert(x == 0 || lcm(a, b) == (a * b < 0 ? -(a * b) : a * b) / x);
+        }
 
-                auto ret2 = (BigInt(num2) >> i) - (BigInt(num2) / akr::pow(2, i));
-                assert(-1 <= ret2 && ret2 <= 1);
+        assert(gcd(0, 0) == 0 && lcm(0, 5) == 0 && gcd(-12, 18) == 6 && lcm(-4, 6) == 12);
+        assert(gcd(factorial(300), pow(BigInt(2), 500) * 3) == pow(BigInt(2), 296) * 3);
+    });
+
+    AKR_TEST(BigIntRandom,
+    {
+        auto re1 = std::mt19937_64(2022);
+        auto re2 = std::mt19937(1997);
+        auto re3 = std::minstd_rand(7);
+
+        auto counts = std::vector<int>(10);
+
+        for (auto i = 0zu; i < 3000; i++)
+        {
+            const auto bits = i % 300;
+
+            const auto value1 = random_bits(re1, bits);
+            const auto value2 = random_bits(re2, bits);
+            const auto value3 = random_bits(re3, bits);
+
+            assert(value1 >= 0 && value1.bit_length() <= bits && value2 >= 0 && value2.bit_length() <= bits && value3 >= 0 && value3.bit_length() <= bits);
+
+            const auto bound = (BigInt(1) << bits) + BigInt(i) * 7 + 1;
+
+            const auto below = random_below(re3, bound);
+
+            assert(below >= 0 && below < bound);
+
+            counts[random_below(re1, 10).ToInteger<std::size_t>()]++;
+        }
+
+        for (auto&& e : counts)
+        {
+            assert(e > 200 && e < 400);
+        }
+
+        // every bit is set about half the time.
+        auto ones = std::vector<int>(256);
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            const auto value = random_bits(re3, 256);
+
+            for (auto j = 0zu; j < ones.size(); j++)
+            {
+                ones[j] += value.test_bit(j) ? 1 : 0;
+            }
+        }
+
+        for (auto&& e : ones)
+        {
+            assert(e > 400 && e < 600);
+        }
+
+        assert(random_bits(re1, 0) == 0 && random_below(re2, 1) == 0);
+
+        try
+        {
+            random_below(re1, 0);
+        }
+        catch (const std::invalid_argument&)
+        {
+            counts[0] = -1;
+        }
+
+        assert(counts[0] == -1);
+    });
+
+    struct CountingResource final : std::pmr::memory_resource
+    {
+        std::atomic<std::size_t> count = 0;
+
+        auto do_allocate  (std::size_t bytes, std::size_t align) -> void* override
+        {
+            count++;
+
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t align) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+
+        auto do_is_equal  (const std::pmr::memory_resource& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+    };
+
+    AKR_TEST(BigIntResource,
+    {
+        using namespace literals;
+
+        const auto expect = factorial(700) * factorial(300) / binomial(1000, 300) + 2;
+
+        auto buffer = std::pmr::monotonic_buffer_resource();
+
+        auto kept = BigInt();
+
+        {
+            const auto scope = ResourceScope(&buffer);
+
+            auto a = factorial(700) * factorial(300);
+            auto b = a / binomial(1000, 300);
+
+            assert(a.resource() == &buffer && b.resource() == &buffer);
+            assert((2022_akr_bigint).resource() == std::pmr::get_default_resource());
+
+            kept.swap(b);
+
+            assert(kept.resource() == &buffer && b.resource() == std::pmr::get_default_resource());
+
+            BigInt(kept + 2, std::pmr::get_default_resource()).swap(kept);
+        }
+
+        buffer.release();
+
+        assert(kept.resource() == std::pmr::get_default_resource() && kept == expect);
+
+        auto counter = CountingResource();
+
+        set_thread_count(3);
+        set_parallel_threshold(0);
+
+        for (auto isThreadSafe = 0; isThreadSafe < 2; isThreadSafe++)
+        {
+            const auto scope = ResourceScope(&counter, isThreadSafe == 1);
+
+            const auto count = counter.count.load();
+
+            auto c = factorial(700) * factorial(300) / binomial(1000, 300) + 2;
+
+            assert(c == expect && c.resource() == &counter && counter.count > count);
+        }
+
+        set_thread_count(1);
+        set_parallel_threshold(1024 * 64);
+    });
+
+    AKR_TEST(BigIntResourceUpdate,
+    {
+        const auto x0 = BigInt(1) << 5000;
+        const auto y0 = BigInt(3) << 4000;
+
+        auto x = x0;
+        auto y = y0;
+        auto z = BigInt(7);
+        auto kept = BigInt();
+        auto out = std::vector<BigInt>(2);
+
+        {
+            auto buffer = std::pmr::monotonic_buffer_resource();
+
+            const auto scope = ResourceScope(&buffer);
+
+            const auto scoped = x0 + 1;
+
+            x *= y;
+            y /= 12345;
+            z.pow_assign(700);
+            kept = scoped;
+
+            add(out, std::vector<BigInt> { x0, 1 }, std::vector<BigInt> { y0, -1 });
+
+            assert(x.resource() == std::pmr::get_default_resource() && kept.resource() == std::pmr::get_default_resource());
+        }
+
+        assert(x == (BigInt(3) << 9000) && y == y0 / 12345 && z == pow(BigInt(7), 700) && kept == x0 + 1);
+        assert(out[0] == x0 + y0 && out[1] == 0);
+
+        x *= y;
+        kept += x;
+
+        assert(kept == x0 + 1 + (BigInt(3) << 9000) * (y0 / 12345));
+    });
+
+    AKR_TEST(BigIntThreeAddress,
+    {
+        auto re = std::mt19937_64(2022);
+
+        for (auto i = 0; i < 300; i++)
+        {
+            auto a = random_bits(re, re() % 4000);
+            auto b = random_bits(re, re() % 4000) + 1;
+
+            a = re() % 2 == 0 ? a : -a;
+            b = re() % 2 == 0 ? b : -b;
+
+            auto out = BigInt();
+            auto q   = BigInt();
+            auto r   = BigInt();
+
+            add(out, a, b);
+            assert(out == a + b);
+            sub(out, a, b);
+            assert(out == a - b);
+            mul(out, a, b);
+            assert(out == a * b);
+            divmod(q, r, a, b);
+            assert(q == a / b && r == a % b);
+
+            auto x = a;
+            auto y = b;
+
+            add(x, x, x);
+            assert(x == a * 2);
+            sub(y, a, y);
+            assert(y == a - b);
+            mul(x, a, x);
+            assert(x == a * a * 2);
+
+            x = a;
+            y = b;
+
+            divmod(y, x, x, y);
+            assert(y == a / b && x == a % b);
+        }
+
+        for (auto&& a : { BigInt(0), BigInt(-1), BigInt(1), BigInt(-2) })
+        {
+            for (auto&& b : { BigInt(-1), BigInt(1), BigInt(3), BigInt(-4) })
+            {
+                auto out = BigInt(5);
+                auto q   = BigInt(5);
+                auto r   = BigInt(5);
+
+                add(out, a, b);
+                assert(out == a + b);
+                sub(out, a, b);
+                assert(out == a - b);
+                mul(out, a, b);
+                assert(out == a * b);
+                divmod(q, r, a, b);
+                assert(q == a / b && r == a % b);
+            }
+        }
+
+        auto x = BigInt(1);
+
+        try { divmod(x, x, x, x); assert(false); } catch (const std::invalid_argument&) {}
+        try { divmod(x, x, x, 0); assert(false); } catch (const std::invalid_argument&) {}
+
+        x.reserve(5000);
+
+        assert(x.capacity() >= 5000 && x == 1);
+
+        x.shrink_to_fit();
+
+        assert(x.capacity() < 5000 && x == 1);
+
+        auto counter = CountingResource();
+
+        const auto scope = ResourceScope(&counter);
+
+        const auto a = random_bits(re, 1000);
+        const auto b = random_bits(re, 900) + 1;
+
+        auto out = BigInt();
+        auto q   = BigInt();
+        auto r   = BigInt();
+
+        const auto round_ = [&]
+        {
+            mul(out, a, b);
+            add(out, out, a);
+            divmod(q, r, out, b);
+            sub(out, q, a);
+        };
+
+        round_();
+
+        const auto count = counter.count.load();
+
+        for (auto i = 0; i < 100; i++)
+        {
+            round_();
+        }
+
+        assert(counter.count == count && q == a + a / b && r == a % b && out == a / b);
+    });
+
+    AKR_TEST(BigIntBytes,
+    {
+        const auto bytesOf = [](std::initializer_list<int> list_)
+        {
+            auto bytes_ = std::vector<std::byte>();
+
+            for (auto e_ : list_)
+            {
+                bytes_.push_back(static_cast<std::byte>(e_));
+            }
+
+            return bytes_;
+        };
+
+        assert(BigInt(0x0102).to_bytes(std::endian::big) == bytesOf({ 0x01, 0x02 }));
+        assert(BigInt(0x0102).to_bytes() == bytesOf({ 0x02, 0x01 }));
+        assert(BigInt(128).to_bytes(std::endian::big) == bytesOf({ 0x00, 0x80 }));
+        assert(BigInt(128).to_bytes(std::endian::big, false) == bytesOf({ 0x80 }));
+        assert(BigInt(-128).to_bytes() == bytesOf({ 0x80 }) && BigInt(-1).to_bytes() == bytesOf({ 0xFF }));
+        assert(BigInt(0).to_bytes() == bytesOf({ 0x00 }) && BigInt(0).to_bytes(std::endian::little, false).empty());
+
+        assert(BigInt::from_bytes(bytesOf({ 0xFF, 0x7F })) == 0x7FFF && BigInt::from_bytes(bytesOf({ 0xFF, 0x7F }), std::endian::big) == -129);
+        assert(BigInt::from_bytes(bytesOf({ 0xFF, 0x7F }), std::endian::big, false) == 0xFF7F && BigInt::from_bytes({}) == 0);
+
+        auto padded = std::vector<std::byte>(12);
+
+        BigInt(-2).to_bytes(padded, std::endian::big);
+
+        assert(padded[0] == std::byte(0xFF) && padded[11] == std::byte(0xFE) && BigInt::from_bytes(padded, std::endian::big) == -2);
+
+        auto isThrown = 0;
+
+        try
+        {
+            BigInt(65536).to_bytes(std::span(padded).first(2), std::endian::big, false);
+        }
+        catch (const std::out_of_range&)
+        {
+            isThrown++;
+        }
+
+        try
+        {
+            BigInt(-1).to_bytes(std::endian::little, false);
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        assert(isThrown == 2);
+
+        auto stream = std::vector<std::byte>();
+
+        auto values = std::vector<BigInt>();
+
+        for (auto i = 0; i < 40; i++)
+        {
+            values.push_back(pow(BigInt(i % 2 == 0 ? 3 : -3), i * 7) - i % 3);
+
+            for (auto isSigned = 0; isSigned < 2; isSigned++)
+            {
+                for (auto isBig = 0; isBig < 2; isBig++)
+                {
+                    const auto order = isBig == 1 ? std::endian::big : std::endian::little;
+
+                    if (isSigned == 1 || values.back() >= 0)
+                    {
+                        assert(BigInt::from_bytes(values.back().to_bytes(order, isSigned == 1), order, isSigned == 1) == values.back());
+                    }
+                }
             }
+
+            const auto prefixed = values.back().to_prefixed_bytes();
+
+            stream.insert(stream.end(), prefixed.begin(), prefixed.end());
+        }
+
+        auto remain = std::span<const std::byte>(stream);
+
+        for (auto&& e : values)
+        {
+            auto copy = remain;
+
+            const auto view = BigIntView::from_prefixed_bytes(copy);
+
+            assert(view == e && view.ToBigInt() == e && view.byte_size() % 8 == 0);
+            assert(view.is_negative() == (e < 0) && view < e + 1 && view > e - 1);
+            assert(view.limbs() && view.limbs()->size() == view.limb_count());
+
+            assert(BigInt::from_prefixed_bytes(remain) == e);
+        }
+
+        assert(remain.empty());
+
+        const auto bigEndian = BigInt(-300).to_bytes(std::endian::big);
+
+        assert(BigIntView(bigEndian, std::endian::big) == -300 && !BigIntView(bigEndian, std::endian::big).limbs());
+        assert(BigIntView(bigEndian, std::endian::big).limb(0) == static_cast<detail::Limb>(-300) && BigIntView(bigEndian, std::endian::big).limb(5) == ~detail::Limb(0));
+        assert(BigIntView(bigEndian, std::endian::big, false) == 65536 - 300);
+
+        try
+        {
+            auto truncated = std::span<const std::byte>(stream).first(12);
+
+            BigInt::from_prefixed_bytes(truncated);
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
         }
+
+        assert(isThrown == 3);
     });
 }
 #endif//D_AKR_TEST
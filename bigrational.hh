@@ -0,0 +1,641 @@
+#ifndef Z_AKR_BIGRATIONAL_HH
+#define Z_AKR_BIGRATIONAL_HH
+
+#include "bigint.hh"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace akr
+{
+    // an exact fraction with a positive denominator. Results are not reduced as they are computed, the gcd is
+    // taken only when the parts are read or printed, and integers and powers of two in the denominator take
+    // shortcuts that need no gcd at all. Reading a value may reduce it, so one value must not be read from
+    // several threads at once.
+    struct BigRational final
+    {
+        private:
+        mutable BigInt numer;
+
+        mutable BigInt denom     = 1;
+
+        mutable bool   isReduced = true;
+
+        public:
+        BigRational() = default;
+
+        template<std::integral T>
+        BigRational(T number):
+            numer(number)
+        {
+        }
+
+        BigRational(const BigInt& integer):
+            numer(integer)
+        {
+        }
+
+        BigRational(BigInt numerator, BigInt denominator):
+            numer(std::move(numerator)), denom(std::move(denominator)), isReduced(false)
+        {
+            if (denom == 0)
+            {
+                throw std::invalid_argument("right operand is zero.");
+            }
+
+            if (denom < 0)
+            {
+                numer = -numer;
+                denom = -denom;
+            }
+        }
+
+        // the exact value of a finite double.
+        explicit BigRational(double number)
+        {
+            if (!std::isfinite(number))
+            {
+                throw std::invalid_argument("double is not finite.");
+            }
+
+            auto exponent = 0;
+
+            const auto mantissa = static_cast<std::int64_t>(std::ldexp(std::frexp(number, &exponent), 53));
+
+            exponent -= 53;
+
+            numer = mantissa;
+
+            if (exponent >= 0)
+            {
+                numer = numer << static_cast<std::size_t>(exponent);
+            }
+            else
+            {
+                denom = BigInt(1) << static_cast<std::size_t>(-exponent);
+
+                isReduced = false;
+            }
+        }
+
+        template<std::size_t N>
+        BigRational(const char(&numChars)[N]):
+            BigRational(std::string_view(numChars, N - 1))
+        {
+        }
+
+        template<class T>
+        requires(std::same_as<typename T::value_type, char>)
+        BigRational(const T& numStrContainer):
+            BigRational(std::string_view(numStrContainer.begin(), numStrContainer.end()))
+        {
+        }
+
+        private:
+        // "n", "n/d" with any prefix BigInt accepts in each part, or a decimal like "-12.5e-3", which takes no prefix.
+        BigRational(std::string_view numStrView)
+        {
+            if (const auto slash = numStrView.find('/'); slash != std::string_view::npos)
+            {
+                BigRational(BigInt(std::string(numStrView.substr(0, slash))), BigInt(std::string(numStrView.substr(slash + 1)))).swap(*this);
+
+                return;
+            }
+
+            const auto isHex = numStrView.find_first_of("xX") != std::string_view::npos;
+
+            const auto point    = numStrView.find('.');
+            const auto exponent = isHex ? std::string_view::npos : numStrView.find_first_of("eE");
+
+            if (point == std::string_view::npos && exponent == std::string_view::npos)
+            {
+                numer = BigInt(std::string(numStrView));
+
+                return;
+            }
+
+            const auto mantissa = numStrView.substr(0, exponent);
+
+            auto digits = std::string(mantissa.substr(0, point));
+
+            auto scale = 0L;
+
+            if (point != std::string_view::npos)
+            {
+                const auto fraction = mantissa.substr(point + 1);
+
+                if (fraction.find_first_not_of("0123456789") != std::string_view::npos)
+                {
+                    throw std::invalid_argument("character is invalid.");
+                }
+
+                digits += fraction;
+
+                scale -= static_cast<long>(fraction.size());
+            }
+
+            // both the integer part and the fraction are empty, as in "." or "e5".
+            if (digits.empty() || digits == "+" || digits == "-")
+            {
+                throw std::invalid_argument("character is invalid.");
+            }
+
+            if (exponent != std::string_view::npos)
+            {
+                const auto text = numStrView.substr(exponent + 1);
+
+                auto value = 0L;
+
+                const auto first = text.data() + (text.starts_with('+') ? 1 : 0);
+
+                if (const auto [ptr, ec] = std::from_chars(first, text.data() + text.size(), value);
+                    ec != std::errc() || ptr != text.data() + text.size())
+                {
+                    throw std::invalid_argument("character is invalid.");
+                }
+
+                scale += value;
+            }
+
+            // a leading zero is not an octal prefix here, and a prefix like "0x" in front of a point is rejected.
+            numer = BigInt(digits, 10);
+
+            if (scale >= 0)
+            {
+                numer *= pow(BigInt(10), BigInt(scale));
+            }
+            else
+            {
+                denom = pow(BigInt(10), BigInt(-scale));
+
+                isReduced = false;
+            }
+        }
+
+        public:
+        auto operator+= (const BigRational& rhs) -> BigRational&
+        {
+            auto&& lhs = *this;
+
+            if (&lhs == &rhs)
+            {
+                return lhs += BigRational(rhs);
+            }
+
+            if (lhs.denom == rhs.denom)
+            {
+                lhs.numer += rhs.numer;
+
+                lhs.isReduced = lhs.denom == 1;
+
+                return lhs;
+            }
+
+            // (a + c * b) / b shares no factor with b that a / b did not.
+            if (rhs.denom == 1)
+            {
+                lhs.numer += rhs.numer * lhs.denom;
+
+                return lhs;
+            }
+
+            if (lhs.denom == 1)
+            {
+                lhs.numer = lhs.numer * rhs.denom + rhs.numer;
+                lhs.denom = rhs.denom;
+
+                lhs.isReduced = rhs.isReduced;
+
+                return lhs;
+            }
+
+            if (lhs.denom.popcount() == 1 && rhs.denom.popcount() == 1)
+            {
+                const auto lhsShift = lhs.denom.countr_zero();
+                const auto rhsShift = rhs.denom.countr_zero();
+
+                if (lhsShift < rhsShift)
+                {
+                    lhs.numer = (lhs.numer << (rhsShift - lhsShift)) + rhs.numer;
+                    lhs.denom = rhs.denom;
+                }
+                else
+                {
+                    lhs.numer += rhs.numer << (lhsShift - rhsShift);
+                }
+
+                lhs.isReduced = false;
+
+                return lhs;
+            }
+
+            lhs.numer = lhs.numer * rhs.denom + rhs.numer * lhs.denom;
+            lhs.denom *= rhs.denom;
+
+            lhs.isReduced = false;
+
+            return lhs;
+        }
+        auto operator-= (const BigRational& rhs) -> BigRational&
+        {
+            return *this += -rhs;
+        }
+        auto operator*= (const BigRational& rhs) -> BigRational&
+        {
+            auto&& lhs = *this;
+
+            if (&lhs == &rhs)
+            {
+                return lhs *= BigRational(rhs);
+            }
+
+            lhs.numer *= rhs.numer;
+
+            if (rhs.denom != 1)
+            {
+                lhs.denom *= rhs.denom;
+
+                lhs.isReduced = false;
+            }
+            else if (lhs.denom != 1)
+            {
+                lhs.isReduced = false;
+            }
+
+            return lhs;
+        }
+        auto operator/= (const BigRational& rhs) -> BigRational&
+        {
+            auto&& lhs = *this;
+
+            if (rhs.numer == 0)
+            {
+                throw std::invalid_argument("right operand is zero.");
+            }
+
+            if (&lhs == &rhs)
+            {
+                return lhs = 1;
+            }
+
+            lhs.numer *= rhs.denom;
+            lhs.denom *= rhs.numer;
+
+            if (lhs.denom < 0)
+            {
+                lhs.numer = -lhs.numer;
+                lhs.denom = -lhs.denom;
+            }
+
+            lhs.isReduced = lhs.denom == 1;
+
+            return lhs;
+        }
+
+        public:
+        friend auto operator+ (const BigRational& rhs) -> const BigRational&
+        {
+            return rhs;
+        }
+        friend auto operator- (const BigRational& rhs) -> BigRational
+        {
+            auto ret = rhs;
+
+            ret.numer = -ret.numer;
+
+            return ret;
+        }
+
+        friend auto operator+ (const BigRational& lhs, const BigRational& rhs) -> BigRational
+        {
+            return BigRational(lhs) += rhs;
+        }
+        friend auto operator- (const BigRational& lhs, const BigRational& rhs) -> BigRational
+        {
+            return BigRational(lhs) -= rhs;
+        }
+        friend auto operator* (const BigRational& lhs, const BigRational& rhs) -> BigRational
+        {
+            return BigRational(lhs) *= rhs;
+        }
+        friend auto operator/ (const BigRational& lhs, const BigRational& rhs) -> BigRational
+        {
+            return BigRational(lhs) /= rhs;
+        }
+
+        // compared by cross multiplication, neither side is reduced.
+        friend auto operator== (const BigRational& lhs, const BigRational& rhs) -> bool
+        {
+            if (lhs.denom == rhs.denom)
+            {
+                return lhs.numer == rhs.numer;
+            }
+
+            return lhs.numer * rhs.denom == rhs.numer * lhs.denom;
+        }
+        friend auto operator<=>(const BigRational& lhs, const BigRational& rhs) -> std::strong_ordering
+        {
+            const auto lhsValue = lhs.denom == rhs.denom ? lhs.numer : lhs.numer * rhs.denom;
+            const auto rhsValue = lhs.denom == rhs.denom ? rhs.numer : rhs.numer * lhs.denom;
+
+            if (lhsValue == rhsValue)
+            {
+                return std::strong_ordering::equal;
+            }
+
+            return lhsValue < rhsValue ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+
+        friend auto operator<<(std::ostream& lhs, const BigRational& rhs) -> std::ostream&
+        {
+            return lhs << rhs.ToStdString();
+        }
+
+        public:
+        auto numerator  () const -> const BigInt&
+        {
+            reduce();
+
+            return numer;
+        }
+
+        auto denominator() const -> const BigInt&
+        {
+            reduce();
+
+            return denom;
+        }
+
+        void swap(BigRational& rhs) noexcept
+        {
+            numer.swap(rhs.numer);
+            denom.swap(rhs.denom);
+
+            std::swap(isReduced, rhs.isReduced);
+        }
+
+        // "n" for integers and "n/d" otherwise, in lowest terms.
+        auto ToStdString(int base = 10) const -> std::string
+        {
+            reduce();
+
+            if (denom == 1)
+            {
+                return numer.ToStdString(base);
+            }
+
+            return numer.ToStdString(base) + '/' + denom.ToStdString(base);
+        }
+
+        // the decimal expansion rounded half away from zero to the given number of fraction digits.
+        auto ToDecimalString(std::size_t precision) const -> std::string
+        {
+            const auto scaled = (numer < 0 ? -numer : numer) * pow(BigInt(10), BigInt(precision));
+
+            auto digits = ((scaled * 2 + denom) / (denom * 2)).ToStdString();
+
+            if (digits.size() <= precision)
+            {
+                digits.insert(0, precision + 1 - digits.size(), '0');
+            }
+
+            if (precision > 0)
+            {
+                digits.insert(digits.size() - precision, 1, '.');
+            }
+
+            if (numer < 0 && digits.find_first_not_of("0.") != std::string::npos)
+            {
+                digits.insert(0, 1, '-');
+            }
+
+            return digits;
+        }
+
+        // the nearest double, the quotient is taken to 64 bits and whatever remains only breaks ties, subnormals included.
+        auto ToDouble() const -> double
+        {
+            if (numer == 0)
+            {
+                return 0.0;
+            }
+
+            auto lhs = numer < 0 ? -numer : numer;
+            auto rhs = denom;
+
+            const auto shift = 65 - (static_cast<long>(lhs.bit_length()) - static_cast<long>(rhs.bit_length()));
+
+            if (shift > 0)
+            {
+                lhs = lhs << static_cast<std::size_t>(shift);
+            }
+            else
+            {
+                rhs = rhs << static_cast<std::size_t>(-shift);
+            }
+
+            const auto quotient = lhs / rhs;
+
+            const auto extra = quotient.bit_length() - 64;
+
+            auto top = (quotient >> extra).ToInteger<std::uint64_t>();
+
+            auto exponent = static_cast<long>(extra) - shift;
+
+            const auto isInexact = quotient.countr_zero() < extra || quotient * rhs != lhs;
+
+            // below the normal range the double keeps fewer bits than top, so top is rounded once, at the last bit the
+            // subnormal keeps, and the scaling that follows is exact.
+            if (constexpr auto Lowest = static_cast<long>(std::numeric_limits<double>::min_exponent - std::numeric_limits<double>::digits);
+                exponent + 63 < Lowest + std::numeric_limits<double>::digits - 1)
+            {
+                const auto drop = Lowest - exponent;
+
+                if (drop > 64)
+                {
+                    top = 0;
+                }
+                else
+                {
+                    const auto kept = drop < 64 ? top >> drop : 0;
+                    const auto rest = drop < 64 ? top & ((std::uint64_t(1) << drop) - 1) : top;
+                    const auto half = std::uint64_t(1) << (drop - 1);
+
+                    top = kept + (rest > half || (rest == half && (isInexact || kept % 2 == 1)) ? 1 : 0);
+                }
+
+                exponent = Lowest;
+            }
+            else if (isInexact)
+            {
+                top |= 1;
+            }
+
+            const auto ret = std::ldexp(static_cast<double>(top), static_cast<int>(exponent));
+
+            return numer < 0 ? -ret : ret;
+        }
+
+        private:
+        void reduce() const
+        {
+            if (isReduced)
+            {
+                return;
+            }
+
+            if (numer == 0)
+            {
+                denom = 1;
+            }
+            else if (denom.popcount() == 1)
+            {
+                const auto shift = std::min(numer.countr_zero(), denom.countr_zero());
+
+                numer = numer >> shift;
+                denom = denom >> shift;
+            }
+            else if (const auto divisor = gcd(numer, denom); divisor != 1)
+            {
+                numer.divexact(divisor);
+                denom.divexact(divisor);
+            }
+
+            isReduced = true;
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+namespace akr::test
+{
+    AKR_TEST(BigRational,
+    {
+        auto harmonic = BigRational();
+
+        for (auto i = 1; i <= 10; i++)
+        {
+            harmonic += BigRational(1, i);
+        }
+
+        assert(harmonic == BigRational(7381, 2520) && harmonic.ToStdString() == "7381/2520" && harmonic.denominator() == 2520);
+
+        auto dyadic = BigRational();
+
+        for (auto i = 0zu; i < 200; i++)
+        {
+            dyadic += BigRational(i % 2 == 0 ? 1 : -1, BigInt(1) << i);
+        }
+
+        assert(dyadic.denominator() == BigInt(1) << 199 && dyadic * 3 == 2 - BigRational(1, BigInt(1) << 199));
+
+        assert(BigRational(6, -4).ToStdString() == "-3/2" && BigRational(6, 3).ToStdString() == "2" && BigRational(0, -7).ToStdString() == "0");
+        assert(BigRational(1, 3) < BigRational(1, 2) && BigRational(-1, 2) < BigRational(-1, 3) && BigRational(2, 4) == BigRational(1, 2));
+        assert(BigRational(7, 3) - BigRational(1, 3) == 2 && BigRational(7, 3) / BigRational(-7, 6) == -2 && BigRational(3, 5) * BigInt(5) == 3);
+
+        auto self = BigRational(5, 7);
+
+        self += self;
+        self *= self;
+
+        assert(self == BigRational(100, 49) && (self /= self) == 1);
+
+        assert(BigRational("1.25") == BigRational(5, 4) && BigRational("-3.5e-2") == BigRational(-7, 200) && BigRational("12e3") == 12000);
+        assert(BigRational("-0x10/0b110") == BigRational(-8, 3) && BigRational("-.5") == BigRational(-1, 2) && BigRational(std::string("42")) == 42);
+        assert(BigRational("0.25") == BigRational(1, 4) && BigRational("-0.9") == BigRational(-9, 10) && BigRational("012.5e1") == 125 && BigRational("010") == 8);
+
+        assert(BigRational(1, 3).ToDecimalString(5) == "0.33333" && BigRational(2, 3).ToDecimalString(3) == "0.667");
+        assert(BigRational(-1, 8).ToDecimalString(2) == "-0.13" && BigRational(-1, 300).ToDecimalString(2) == "0.00");
+        assert(BigRational(123, 1).ToDecimalString(0) == "123" && BigRational(-5, 2).ToDecimalString(1) == "-2.5");
+
+        assert(BigRational(1, 3).ToDouble() == 1.0 / 3 && BigRational(-2, 7).ToDouble() == -2.0 / 7);
+        assert(BigRational(pow(BigInt(10), 400), pow(BigInt(10), 399) * 3).ToDouble() == 10.0 / 3);
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            const auto value = std::ldexp(static_cast<double>(i * 7919 % 1000 + 1) / 997, i % 300 - 150) * (i % 2 == 0 ? 1 : -1);
+
+            assert(BigRational(value).ToDouble() == value && BigRational(BigRational(value).ToStdString()).ToDouble() == value);
+        }
+
+        constexpr auto Min  = std::numeric_limits<double>::min();
+        constexpr auto Tiny = std::numeric_limits<double>::denorm_min();
+
+        assert(BigRational(0xba83635ea796d4, BigInt(1) << 1079).ToDouble() == 0x0.5d41b1af53cb7p-1022);
+        assert(BigRational(-0x25b25e9cd7f5421, BigInt(1) << 1080).ToDouble() == -0x0.96c97a735fd51p-1022);
+
+        assert(BigRational(Min).ToDouble() == Min && BigRational(Min - Tiny).ToDouble() == Min - Tiny && BigRational(-Tiny).ToDouble() == -Tiny);
+        assert((BigRational(Tiny) / 2).ToDouble() == 0 && std::signbit((BigRational(-Tiny) / 2).ToDouble()) && (BigRational(Tiny) / 3).ToDouble() == 0);
+
+        const auto epsilon = BigRational(1, BigInt(1) << 1200);
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            const auto k = i < 2 ? (std::uint64_t(1) << 52) - 1 + i : (std::uint64_t(i) * 0x9E3779B97F4A7C15) >> (12 + i % 52);
+
+            const auto lower = static_cast<double>(k) * Tiny;
+            const auto upper = static_cast<double>(k + 1) * Tiny;
+
+            const auto tie = (BigRational(lower) + BigRational(upper)) / 2;
+
+            assert(tie.ToDouble() == (k % 2 == 0 ? lower : upper) && (-tie).ToDouble() == -tie.ToDouble());
+            assert((tie + epsilon).ToDouble() == upper && (tie - epsilon).ToDouble() == lower);
+        }
+
+        auto isThrown = 0;
+
+        try
+        {
+            BigRational(1, 0);
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        try
+        {
+            BigRational("1.2.3");
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        try
+        {
+            BigRational(std::nan(""));
+        }
+        catch (const std::invalid_argument&)
+        {
+            isThrown++;
+        }
+
+        for (auto&& e : { "0x1.8", "0b1.1", "-0X.8", "e5", ".", "-.", "+e3", "-e-2" })
+        {
+            try
+            {
+                BigRational(std::string(e));
+            }
+            catch (const std::invalid_argument&)
+            {
+                isThrown++;
+            }
+        }
+
+        assert(isThrown == 11);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_BIGRATIONAL_HH
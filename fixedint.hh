@@ -0,0 +1,891 @@
+#ifndef Z_AKR_FIXEDINT_HH
+#define Z_AKR_FIXEDINT_HH
+
+#include "bigint.hh"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace akr
+{
+    enum class OverflowMode
+    {
+        Wrap,
+        Check,
+    };
+
+    // a BigInt of a fixed width, stored in place. Signed values are two's complement,
+    // OverflowMode::Wrap reduces every result modulo 2^Bits, OverflowMode::Check throws std::overflow_error instead.
+    template<std::size_t Bits, bool Signed = true, OverflowMode Mode = OverflowMode::Wrap>
+    struct FixedInt final
+    {
+        static_assert(Bits > 0, "width is zero.");
+
+        template<std::size_t OBits, bool OSigned, OverflowMode OMode>
+        friend struct FixedInt;
+
+        private:
+        using Limb  = detail::Limb;
+
+        static constexpr auto LimbBits  = detail::LimbBits;
+
+        static constexpr auto LimbCount = (Bits + LimbBits - 1) / LimbBits;
+
+        static constexpr auto TopBits   = Bits - (LimbCount - 1) * LimbBits;
+
+        using Limbs = std::array<Limb, LimbCount>;
+
+        private:
+        Limbs limbs {};
+
+        public:
+        constexpr FixedInt() noexcept = default;
+
+        template<std::integral T>
+        constexpr FixedInt(T number)
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                const auto value = static_cast<std::intmax_t>(number);
+
+                assignInteger(static_cast<std::uintmax_t>(value), value < 0);
+            }
+            else
+            {
+                assignInteger(static_cast<std::uintmax_t>(number), false);
+            }
+        }
+
+        template<std::size_t N>
+        constexpr FixedInt(const char(&numChars)[N], std::optional<int> base = std::nullopt):
+            FixedInt(std::string_view(numChars, N - 1), base)
+        {
+        }
+
+        template<class T>
+        requires(std::same_as<typename T::value_type, char>)
+        constexpr FixedInt(const T& numStrContainer, std::optional<int> base = std::nullopt):
+            FixedInt(std::string_view(numStrContainer.begin(), numStrContainer.end()), base)
+        {
+        }
+
+        explicit FixedInt(const BigInt& number)
+        {
+            const auto numLimbs = number.toLimbs();
+
+            assign(numLimbs.data(), numLimbs.size(), number.isNegative);
+        }
+
+        template<std::size_t OBits, bool OSigned, OverflowMode OMode>
+        explicit constexpr FixedInt(const FixedInt<OBits, OSigned, OMode>& number)
+        {
+            assign(number.limbs.data(), number.limbs.size(), number.isNegative());
+        }
+
+        private:
+        constexpr FixedInt(std::string_view numStrView, std::optional<int> base)
+        {
+            const auto parsed = detail::parse_prefix(numStrView, base);
+
+            auto magnitude = std::array<Limb, LimbCount + 1> {};
+
+            const auto isFit = detail::parse_magnitude(magnitude.data(), magnitude.size(), parsed.digits, parsed.base);
+
+            if constexpr (Mode == OverflowMode::Check)
+            {
+                if (!isFit)
+                {
+                    throw std::overflow_error("integer overflow.");
+                }
+            }
+
+            assignMagnitude(magnitude, parsed.isNegative);
+        }
+
+        public:
+        constexpr auto operator+= (const FixedInt& rhs) -> FixedInt&
+        {
+            auto&& lhs = *this;
+
+            auto ret = std::array<Limb, LimbCount + 1> {};
+
+            auto carry = Limb(0);
+
+            unroll([&](std::size_t i_)
+                   {
+                       ret[i_] = detail::add_with_carry(lhs.limbs[i_], rhs.limbs[i_], carry);
+                   });
+
+            ret[LimbCount] = lhs.signFill() + rhs.signFill() + carry;
+
+            lhs.assign(ret.data(), ret.size(), ret[LimbCount] >> (LimbBits - 1));
+
+            return lhs;
+        }
+        constexpr auto operator-= (const FixedInt& rhs) -> FixedInt&
+        {
+            auto&& lhs = *this;
+
+            auto ret = std::array<Limb, LimbCount + 1> {};
+
+            auto borrow = Limb(0);
+
+            unroll([&](std::size_t i_)
+                   {
+                       ret[i_] = detail::sub_with_borrow(lhs.limbs[i_], rhs.limbs[i_], borrow);
+                   });
+
+            ret[LimbCount] = lhs.signFill() - rhs.signFill() - borrow;
+
+            lhs.assign(ret.data(), ret.size(), ret[LimbCount] >> (LimbBits - 1));
+
+            return lhs;
+        }
+        constexpr auto operator*= (const FixedInt& rhs) -> FixedInt&
+        {
+            auto&& lhs = *this;
+
+            if constexpr (Mode == OverflowMode::Wrap)
+            {
+                auto ret = Limbs {};
+
+                for (auto i = 0zu; i < LimbCount; i++)
+                {
+                    detail::addmul_1(ret.data() + i, lhs.limbs.data(), LimbCount - i, rhs.limbs[i]);
+                }
+
+                lhs.limbs = ret;
+
+                lhs.normalize();
+            }
+            else
+            {
+                const auto lhsMagnitude = lhs.magnitude();
+                const auto rhsMagnitude = rhs.magnitude();
+
+                auto ret = std::array<Limb, LimbCount * 2> {};
+
+                detail::mul_basecase(ret.data(), lhsMagnitude.data(), LimbCount, rhsMagnitude.data(), LimbCount);
+
+                lhs.assignMagnitude(ret, lhs.isNegative() != rhs.isNegative());
+            }
+
+            return lhs;
+        }
+        constexpr auto operator/= (const FixedInt& rhs) -> FixedInt&
+        {
+            auto&& lhs = *this;
+
+            auto quotient  = Limbs {};
+            auto remainder = Limbs {};
+
+            divideMagnitude(lhs, rhs, quotient, remainder);
+
+            lhs.assignMagnitude(quotient, lhs.isNegative() != rhs.isNegative());
+
+            return lhs;
+        }
+        constexpr auto operator%= (const FixedInt& rhs) -> FixedInt&
+        {
+            auto&& lhs = *this;
+
+            auto quotient  = Limbs {};
+            auto remainder = Limbs {};
+
+            divideMagnitude(lhs, rhs, quotient, remainder);
+
+            lhs.assignMagnitude(remainder, lhs.isNegative());
+
+            return lhs;
+        }
+
+        constexpr auto pow_assign (const FixedInt& rhs) -> FixedInt&
+        {
+            if (rhs.isNegative())
+            {
+                throw std::invalid_argument("right operand is negative.");
+            }
+
+            auto&& lhs = *this;
+
+            auto tmp = FixedInt(1);
+
+            tmp.swap(lhs);
+
+            for (auto i = rhs.bitWidth(); i > 0;)
+            {
+                i--;
+
+                lhs *= lhs;
+
+                if (rhs.testBit(i))
+                {
+                    lhs *= tmp;
+                }
+            }
+
+            return lhs;
+        }
+
+        constexpr auto operator&= (const FixedInt& rhs) noexcept -> FixedInt&
+        {
+            unroll([&](std::size_t i_) noexcept
+                   {
+                       limbs[i_] &= rhs.limbs[i_];
+                   });
+
+            return *this;
+        }
+        constexpr auto operator|= (const FixedInt& rhs) noexcept -> FixedInt&
+        {
+            unroll([&](std::size_t i_) noexcept
+                   {
+                       limbs[i_] |= rhs.limbs[i_];
+                   });
+
+            return *this;
+        }
+        constexpr auto operator^= (const FixedInt& rhs) noexcept -> FixedInt&
+        {
+            unroll([&](std::size_t i_) noexcept
+                   {
+                       limbs[i_] ^= rhs.limbs[i_];
+                   });
+
+            return *this;
+        }
+
+        constexpr auto operator<<=(std::size_t shift) -> FixedInt&
+        {
+            auto&& lhs = *this;
+
+            if constexpr (Mode == OverflowMode::Check)
+            {
+                auto ret = lhs;
+
+                ret.shiftLeft(shift);
+
+                auto chk = ret;
+
+                chk.shiftRight(shift);
+
+                if (chk != lhs)
+                {
+                    throw std::overflow_error("integer overflow.");
+                }
+
+                lhs = ret;
+            }
+            else
+            {
+                lhs.shiftLeft(shift);
+            }
+
+            return lhs;
+        }
+        constexpr auto operator>>=(std::size_t shift) noexcept -> FixedInt&
+        {
+            shiftRight(shift);
+
+            return *this;
+        }
+
+        constexpr auto operator++ (   ) -> FixedInt&
+        {
+            return *this += FixedInt(1);
+        }
+        constexpr auto operator++ (int) -> FixedInt
+        {
+            auto tmp = *this;
+
+            ++*this;
+
+            return tmp;
+        }
+
+        constexpr auto operator-- (   ) -> FixedInt&
+        {
+            return *this -= FixedInt(1);
+        }
+        constexpr auto operator-- (int) -> FixedInt
+        {
+            auto tmp = *this;
+
+            --*this;
+
+            return tmp;
+        }
+
+        public:
+        friend constexpr auto operator+ (const FixedInt& rhs) noexcept -> const FixedInt&
+        {
+            return rhs;
+        }
+        friend constexpr auto operator- (const FixedInt& rhs) -> FixedInt
+        {
+            return FixedInt() -= rhs;
+        }
+        friend constexpr auto operator~ (const FixedInt& rhs) noexcept -> FixedInt
+        {
+            auto ret = rhs;
+
+            for (auto&& e : ret.limbs)
+            {
+                e = ~e;
+            }
+
+            ret.normalize();
+
+            return ret;
+        }
+
+        friend constexpr auto operator+ (const FixedInt& lhs, const FixedInt& rhs) -> FixedInt
+        {
+            return FixedInt(lhs) += rhs;
+        }
+        friend constexpr auto operator- (const FixedInt& lhs, const FixedInt& rhs) -> FixedInt
+        {
+            return FixedInt(lhs) -= rhs;
+        }
+        friend constexpr auto operator* (const FixedInt& lhs, const FixedInt& rhs) -> FixedInt
+        {
+            return FixedInt(lhs) *= rhs;
+        }
+        friend constexpr auto operator/ (const FixedInt& lhs, const FixedInt& rhs) -> FixedInt
+        {
+            return FixedInt(lhs) /= rhs;
+        }
+        friend constexpr auto operator% (const FixedInt& lhs, const FixedInt& rhs) -> FixedInt
+        {
+            return FixedInt(lhs) %= rhs;
+        }
+
+        friend constexpr auto operator& (const FixedInt& lhs, const FixedInt& rhs) noexcept -> FixedInt
+        {
+            return FixedInt(lhs) &= rhs;
+        }
+        friend constexpr auto operator| (const FixedInt& lhs, const FixedInt& rhs) noexcept -> FixedInt
+        {
+            return FixedInt(lhs) |= rhs;
+        }
+        friend constexpr auto operator^ (const FixedInt& lhs, const FixedInt& rhs) noexcept -> FixedInt
+        {
+            return FixedInt(lhs) ^= rhs;
+        }
+
+        friend constexpr auto operator<<(const FixedInt& lhs, std::size_t shift) -> FixedInt
+        {
+            return FixedInt(lhs) <<=shift;
+        }
+        friend constexpr auto operator>>(const FixedInt& lhs, std::size_t shift) noexcept -> FixedInt
+        {
+            return FixedInt(lhs) >>=shift;
+        }
+
+        friend constexpr auto operator==(const FixedInt& lhs, const FixedInt& rhs) noexcept -> bool
+        {
+            return lhs.limbs == rhs.limbs;
+        }
+        friend constexpr auto operator!=(const FixedInt& lhs, const FixedInt& rhs) noexcept -> bool
+        {
+            return !(lhs == rhs);
+        }
+
+        friend constexpr auto operator< (const FixedInt& lhs, const FixedInt& rhs) noexcept -> bool
+        {
+            if (lhs.isNegative() != rhs.isNegative())
+            {
+                return lhs.isNegative();
+            }
+
+            return detail::cmp(lhs.limbs.data(), rhs.limbs.data(), LimbCount) < 0;
+        }
+        friend constexpr auto operator>=(const FixedInt& lhs, const FixedInt& rhs) noexcept -> bool
+        {
+            return !(lhs <  rhs);
+        }
+        friend constexpr auto operator> (const FixedInt& lhs, const FixedInt& rhs) noexcept -> bool
+        {
+            return   rhs <  lhs;
+        }
+        friend constexpr auto operator<=(const FixedInt& lhs, const FixedInt& rhs) noexcept -> bool
+        {
+            return !(rhs <  lhs);
+        }
+
+        friend auto operator>>(std::istream& lhs,       FixedInt& rhs) -> std::istream&
+        {
+            auto stdString = std::string();
+
+            lhs >> stdString;
+
+            FixedInt(stdString).swap(rhs);
+
+            return lhs;
+        }
+
+        friend auto operator<<(std::ostream& lhs, const FixedInt& rhs) -> std::ostream&
+        {
+            return lhs << rhs.ToStdString();
+        }
+
+        public:
+        constexpr void swap(FixedInt& rhs) noexcept
+        {
+            limbs.swap(rhs.limbs);
+        }
+
+        public:
+        template<std::integral T>
+        constexpr auto ToInteger  () const -> T
+        {
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                if (isNegative())
+                {
+                    throw std::invalid_argument("unsigned integer is negative.");
+                }
+            }
+
+            const auto numMagnitude = magnitude();
+
+            auto value = std::uintmax_t(0);
+
+            for (auto i = 0zu; i < LimbCount; i++)
+            {
+                if (i * LimbBits >= static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits))
+                {
+                    if (numMagnitude[i] != 0)
+                    {
+                        throw std::out_of_range("integer out of range.");
+                    }
+                }
+                else
+                {
+                    value |= static_cast<std::uintmax_t>(numMagnitude[i]) << (i * LimbBits);
+                }
+            }
+
+            const auto maxValue = static_cast<std::uintmax_t>(std::numeric_limits<T>::max());
+
+            if (value > maxValue + (isNegative() ? 1 : 0))
+            {
+                throw std::out_of_range("integer out of range.");
+            }
+
+            return isNegative() ? static_cast<T>(-static_cast<std::intmax_t>(value - 1) - 1) : static_cast<T>(value);
+        }
+
+        auto ToBigInt   () const -> BigInt
+        {
+            return BigInt::fromLimbs(limbs, isNegative());
+        }
+
+        explicit operator BigInt() const
+        {
+            return ToBigInt();
+        }
+
+        public:
+        constexpr auto ToBinString() const -> std::string
+        {
+            auto binString = std::string(Bits, '0');
+
+            for (auto i = 0zu; i < Bits; i++)
+            {
+                binString[Bits - 1 - i] = testBit(i) ? '1' : '0';
+            }
+
+            return binString;
+        }
+
+        constexpr auto ToStdString(int base = 10) const -> std::string
+        {
+            if (!(2 <= base && base <= 36))
+            {
+                throw std::invalid_argument("base is invalid.");
+            }
+
+            auto numMagnitude = magnitude();
+
+            auto stdString = std::string();
+
+            for (auto size = detail::normalized_size(numMagnitude.data(), LimbCount);;)
+            {
+                const auto digit = detail::divrem_1(numMagnitude.data(), numMagnitude.data(), size, static_cast<Limb>(base));
+
+                stdString.push_back(detail::digit_to_char(static_cast<int>(digit)));
+
+                size = detail::normalized_size(numMagnitude.data(), size);
+
+                if (size == 0)
+                {
+                    break;
+                }
+            }
+
+            if (isNegative())
+            {
+                stdString.push_back('-');
+            }
+
+            std::ranges::reverse(stdString);
+
+            return stdString;
+        }
+
+        private:
+        template<class F>
+        static constexpr void unroll(const F& func)
+        {
+            [&func]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                (func(I), ...);
+            }(std::make_index_sequence<LimbCount>());
+        }
+
+        constexpr auto isNegative () const noexcept -> bool
+        {
+            return Signed && (limbs[LimbCount - 1] >> (LimbBits - 1)) != 0;
+        }
+
+        constexpr auto signFill   () const noexcept -> Limb
+        {
+            return isNegative() ? ~Limb(0) : Limb(0);
+        }
+
+        constexpr auto testBit    (std::size_t i) const noexcept -> bool
+        {
+            return i < LimbCount * LimbBits ? (limbs[i / LimbBits] >> (i % LimbBits)) & 1 : isNegative();
+        }
+
+        constexpr auto bitWidth   () const noexcept -> std::size_t
+        {
+            const auto fill = signFill();
+
+            for (auto i = LimbCount; i > 0; i--)
+            {
+                if (limbs[i - 1] != fill)
+                {
+                    return (i - 1) * LimbBits + static_cast<std::size_t>(std::bit_width(limbs[i - 1] ^ fill));
+                }
+            }
+
+            return 0;
+        }
+
+        // keeps the bits above Bits in the top limb equal to the sign bit.
+        constexpr void normalize  () noexcept
+        {
+            if constexpr (TopBits < LimbBits)
+            {
+                auto&& top = limbs[LimbCount - 1];
+
+                constexpr auto mask = (Limb(1) << TopBits) - 1;
+
+                if (Signed && ((top >> (TopBits - 1)) & 1) != 0)
+                {
+                    top |= ~mask;
+                }
+                else
+                {
+                    top &= mask;
+                }
+            }
+        }
+
+        // whether the value given by two's complement limbs with an infinite sign extension is representable.
+        static constexpr auto isFit(const Limb* numLimbs, std::size_t size, bool isNeg) noexcept -> bool
+        {
+            if (!Signed && isNeg)
+            {
+                return false;
+            }
+
+            const auto fill = isNeg ? ~Limb(0) : Limb(0);
+
+            const auto first = Signed ? Bits - 1 : Bits;
+
+            for (auto i = first / LimbBits; i < size; i++)
+            {
+                const auto mask = i == first / LimbBits ? ~Limb(0) << (first % LimbBits) : ~Limb(0);
+
+                if (((numLimbs[i] ^ fill) & mask) != 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        constexpr void assign     (const Limb* numLimbs, std::size_t size, bool isNeg)
+        {
+            if constexpr (Mode == OverflowMode::Check)
+            {
+                if (!isFit(numLimbs, size, isNeg))
+                {
+                    throw std::overflow_error("integer overflow.");
+                }
+            }
+
+            for (auto i = 0zu; i < LimbCount; i++)
+            {
+                limbs[i] = i < size ? numLimbs[i] : (isNeg ? ~Limb(0) : Limb(0));
+            }
+
+            normalize();
+        }
+
+        constexpr void assignInteger(std::uintmax_t value, bool isNeg)
+        {
+            constexpr auto Count = (static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits) + LimbBits - 1) / LimbBits;
+
+            auto numLimbs = std::array<Limb, Count> {};
+
+            for (auto i = 0zu; i < Count; i++)
+            {
+                numLimbs[i] = static_cast<Limb>(value >> (i * LimbBits));
+            }
+
+            assign(numLimbs.data(), Count, isNeg);
+        }
+
+        template<std::size_t N>
+        constexpr void assignMagnitude(const std::array<Limb, N>& numMagnitude, bool isNeg)
+        {
+            auto numLimbs = std::array<Limb, N + 1> {};
+
+            std::copy(numMagnitude.begin(), numMagnitude.end(), numLimbs.begin());
+
+            isNeg = isNeg && detail::normalized_size(numMagnitude.data(), N) != 0;
+
+            if (isNeg)
+            {
+                for (auto&& e : numLimbs)
+                {
+                    e = ~e;
+                }
+
+                detail::add_1(numLimbs.data(), numLimbs.data(), numLimbs.size(), 1);
+            }
+
+            assign(numLimbs.data(), numLimbs.size(), isNeg);
+        }
+
+        constexpr auto magnitude  () const noexcept -> Limbs
+        {
+            auto ret = limbs;
+
+            if (isNegative())
+            {
+                for (auto&& e : ret)
+                {
+                    e = ~e;
+                }
+
+                detail::add_1(ret.data(), ret.data(), LimbCount, 1);
+            }
+
+            return ret;
+        }
+
+        static constexpr void divideMagnitude(const FixedInt& lhs, const FixedInt& rhs, Limbs& quotient, Limbs& remainder)
+        {
+            const auto lhsMagnitude = lhs.magnitude();
+            const auto rhsMagnitude = rhs.magnitude();
+
+            const auto lhsSize = detail::normalized_size(lhsMagnitude.data(), LimbCount);
+            const auto rhsSize = detail::normalized_size(rhsMagnitude.data(), LimbCount);
+
+            if (rhsSize == 0)
+            {
+                throw std::invalid_argument("right operand is zero.");
+            }
+
+            if (detail::cmp(lhsMagnitude.data(), lhsSize, rhsMagnitude.data(), rhsSize) < 0)
+            {
+                remainder = lhsMagnitude;
+            }
+            else if (rhsSize == 1)
+            {
+                remainder[0] = detail::divrem_1(quotient.data(), lhsMagnitude.data(), lhsSize, rhsMagnitude[0]);
+            }
+            else
+            {
+                auto un = std::array<Limb, LimbCount + 1> {};
+                auto vn = Limbs {};
+
+                detail::divrem(quotient.data(), remainder.data(), lhsMagnitude.data(), lhsSize,
+                               rhsMagnitude.data(), rhsSize, un.data(), vn.data());
+            }
+        }
+
+        constexpr void shiftLeft  (std::size_t shift) noexcept
+        {
+            if (shift >= LimbCount * LimbBits)
+            {
+                limbs.fill(0);
+
+                return;
+            }
+
+            const auto limbShift = shift / LimbBits;
+            const auto bitsShift = shift % LimbBits;
+
+            for (auto i = LimbCount; i > 0; i--)
+            {
+                limbs[i - 1] = i - 1 >= limbShift ? limbs[i - 1 - limbShift] : 0;
+            }
+
+            if (bitsShift > 0)
+            {
+                detail::lshift(limbs.data(), limbs.data(), LimbCount, bitsShift);
+            }
+
+            normalize();
+        }
+
+        constexpr void shiftRight (std::size_t shift) noexcept
+        {
+            const auto fill = signFill();
+
+            if (shift >= LimbCount * LimbBits)
+            {
+                limbs.fill(fill);
+
+                return;
+            }
+
+            const auto limbShift = shift / LimbBits;
+            const auto bitsShift = shift % LimbBits;
+
+            for (auto i = 0zu; i < LimbCount; i++)
+            {
+                limbs[i] = i + limbShift < LimbCount ? limbs[i + limbShift] : fill;
+            }
+
+            if (bitsShift > 0)
+            {
+                detail::rshift(limbs.data(), limbs.data(), LimbCount, bitsShift);
+
+                limbs[LimbCount - 1] |= fill << (LimbBits - bitsShift);
+            }
+
+            normalize();
+        }
+    };
+
+    template<std::size_t Bits, OverflowMode Mode = OverflowMode::Wrap>
+    using FixedUInt = FixedInt<Bits, false, Mode>;
+}
+
+namespace akr::literals
+{
+    // a signed FixedInt just wide enough for the literal and its negation, usable in constant expressions.
+    template<char... C>
+    consteval auto operator""_akr_fixedint()
+    {
+        constexpr auto Magnitude = detail::parse_literal<C...>();
+
+        constexpr auto Bits = Magnitude.size == 0 ? 1 : (Magnitude.size - 1) * detail::LimbBits
+                                                        + std::bit_width(Magnitude.limbs[Magnitude.size - 1]) + 1;
+
+        constexpr auto Literal = detail::literal_chars<C...>();
+
+        return FixedInt<Bits>(std::string_view(Literal.chars.data(), Literal.size));
+    }
+}
+
+#ifdef  D_AKR_TEST
+#include <random>
+
+namespace akr::test
+{
+    using I256 = FixedInt <256>;
+    using U256 = FixedUInt<256>;
+    using C128 = FixedInt <128, true, OverflowMode::Check>;
+
+    AKR_TEST(FixedInt,
+    {
+        const auto isOverflow = [](auto&& func_)
+        {
+            try
+            {
+                static_cast<void>(func_());
+            }
+            catch (const std::overflow_error&)
+            {
+                return true;
+            }
+
+            return false;
+        };
+
+        static_assert(I256("123456789012345678901234567890") * 10 == I256("1234567890123456789012345678900"));
+        static_assert(I256(-7) / 2 == -3 && I256(-7) % 2 == -1);
+        static_assert(U256(0) - 1 == ~U256(0));
+        static_assert((I256(-1) >> 100) == -1 && (U256(1) << 255) > U256(1) << 254);
+        static_assert(FixedInt<8>(127) + 1 == -128 && FixedUInt<8>(255) + 1 == 0);
+        static_assert(FixedInt<70>("0x3FFFFFFFFFFFFFFFFF") == -1);
+
+        using namespace literals;
+
+        static_assert(-0x7E6_akr_fixedint == -2022 && 0_akr_fixedint == 0 && 1'000'000_akr_fixedint == 1000000);
+        static_assert(I256(18446744073709551616_akr_fixedint) == I256(1) << 64);
+        static_assert((170141183460469231731687303715884105727_akr_fixedint).ToStdString() == "170141183460469231731687303715884105727");
+
+        assert(I256("-0x7E6") == -2022 && I256("-0x7E6").ToStdString(16) == "-7E6");
+        assert(C128(-2022).ToInteger<int>() == -2022);
+
+        auto rd = std::random_device();
+        auto re = std::mt19937_64(rd());
+
+        auto id = std::uniform_int_distribution<std::int64_t>(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max());
+
+        for (auto i = 0; i < 100; i++)
+        {
+            const auto num1 = id(re);
+            const auto num2 = id(re) | 1;
+
+            const auto u1 = static_cast<std::uint64_t>(num1);
+            const auto u2 = static_cast<std::uint64_t>(num2);
+
+            using I64 = FixedInt<64>;
+
+            assert(I64(num1) + I64(num2) == static_cast<std::int64_t>(u1 + u2));
+            assert(I64(num1) - I64(num2) == static_cast<std::int64_t>(u1 - u2));
+            assert(I64(num1) * I64(num2) == static_cast<std::int64_t>(u1 * u2));
+            assert(I64(num1) / I64(num2) == num1 / num2);
+            assert(I64(num1) % I64(num2) == num1 % num2);
+            assert((I64(num1) >> (i % 64)) == (num1 >> (i % 64)));
+            assert((I64(num1) <  I64(num2)) == (num1 < num2));
+            assert(I64(num1).ToInteger<std::int64_t>() == num1);
+
+            const auto big1 = BigInt(num1) * num2 * num1 - num2;
+            const auto big2 = BigInt(num2) * num1 + 1;
+
+            assert(I256(big1).ToBigInt() == big1);
+            assert(I256(big1) / I256(big2) == I256(big1 / big2));
+            assert(I256(big1) % I256(big2) == I256(big1 % big2));
+            assert(I256(big1).ToStdString() == big1.ToStdString());
+            assert(C128(num1) * C128(num2) == C128(BigInt(num1) * num2));
+        }
+
+        assert(isOverflow([] { return C128(1) << 127; }));
+        assert(isOverflow([] { return C128(BigInt(1) << 126) * 2; }));
+        assert(isOverflow([] { return C128(BigInt(1) << 127); }));
+        assert(isOverflow([] { return C128(FixedUInt<128>(0) - 1); }));
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_FIXEDINT_HH
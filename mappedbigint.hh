@@ -0,0 +1,575 @@
+#ifndef Z_AKR_MAPPEDBIGINT_HH
+#define Z_AKR_MAPPEDBIGINT_HH
+
+#include "bigint.hh"
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#ifdef  _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif//NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif//_WIN32
+
+namespace akr
+{
+    // a whole file mapped into memory, read-only or writable.
+    struct MappedFile final
+    {
+        private:
+        #ifdef  _WIN32
+        HANDLE      file     = INVALID_HANDLE_VALUE;
+
+        HANDLE      mapping  = nullptr;
+        #else
+        int         file     = -1;
+        #endif//_WIN32
+
+        std::byte*  data     = nullptr;
+
+        std::size_t size     = 0;
+
+        bool        writable = false;
+
+        public:
+        MappedFile() = default;
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept
+        {
+            swap(other);
+        }
+
+        auto operator=(MappedFile other) noexcept -> MappedFile&
+        {
+            swap(other);
+
+            return *this;
+        }
+
+        ~MappedFile()
+        {
+            unmap();
+            close();
+        }
+
+        // maps an existing file.
+        static auto open  (const std::filesystem::path& path, bool writable = false) -> MappedFile
+        {
+            auto ret = MappedFile();
+
+            ret.writable = writable;
+
+            #ifdef  _WIN32
+            ret.file = CreateFileW(path.c_str(), GENERIC_READ | (writable ? GENERIC_WRITE : 0), FILE_SHARE_READ, nullptr,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+            auto fileSize = LARGE_INTEGER {};
+
+            if (ret.file == INVALID_HANDLE_VALUE || !GetFileSizeEx(ret.file, &fileSize))
+            {
+                throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "file cannot be opened.");
+            }
+
+            ret.size = static_cast<std::size_t>(fileSize.QuadPart);
+            #else
+            ret.file = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+
+            struct stat status {};
+
+            if (ret.file < 0 || ::fstat(ret.file, &status) != 0)
+            {
+                throw std::system_error(errno, std::system_category(), "file cannot be opened.");
+            }
+
+            ret.size = static_cast<std::size_t>(status.st_size);
+            #endif//_WIN32
+
+            ret.map();
+
+            return ret;
+        }
+
+        // creates or truncates a file of the given size and maps it writable.
+        static auto create(const std::filesystem::path& path, std::size_t size) -> MappedFile
+        {
+            auto ret = MappedFile();
+
+            ret.writable = true;
+
+            #ifdef  _WIN32
+            ret.file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+            if (ret.file == INVALID_HANDLE_VALUE)
+            {
+                throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "file cannot be created.");
+            }
+            #else
+            ret.file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+            if (ret.file < 0)
+            {
+                throw std::system_error(errno, std::system_category(), "file cannot be created.");
+            }
+            #endif//_WIN32
+
+            ret.resize(size);
+
+            return ret;
+        }
+
+        public:
+        auto bytes  () const noexcept -> std::span<const std::byte>
+        {
+            return { data, size };
+        }
+
+        auto bytes  () noexcept -> std::span<std::byte>
+        {
+            return { data, size };
+        }
+
+        // changes the size of a writable file, the mapping moves.
+        void resize (std::size_t newSize)
+        {
+            unmap();
+
+            #ifdef  _WIN32
+            auto distance = LARGE_INTEGER {};
+
+            distance.QuadPart = static_cast<LONGLONG>(newSize);
+
+            if (!SetFilePointerEx(file, distance, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+            {
+                throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "file cannot be resized.");
+            }
+            #else
+            if (::ftruncate(file, static_cast<off_t>(newSize)) != 0)
+            {
+                throw std::system_error(errno, std::system_category(), "file cannot be resized.");
+            }
+            #endif//_WIN32
+
+            size = newSize;
+
+            map();
+        }
+
+        void swap   (MappedFile& other) noexcept
+        {
+            #ifdef  _WIN32
+            std::swap(mapping, other.mapping);
+            #endif//_WIN32
+            std::swap(file,     other.file);
+            std::swap(data,     other.data);
+            std::swap(size,     other.size);
+            std::swap(writable, other.writable);
+        }
+
+        private:
+        void map    ()
+        {
+            // an empty file cannot be mapped, it is simply an empty span.
+            if (size == 0)
+            {
+                return;
+            }
+
+            #ifdef  _WIN32
+            mapping = CreateFileMappingW(file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+
+            if (mapping != nullptr)
+            {
+                data = static_cast<std::byte*>(MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size));
+            }
+
+            if (data == nullptr)
+            {
+                throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "file cannot be mapped.");
+            }
+            #else
+            auto address = ::mmap(nullptr, size, PROT_READ | (writable ? PROT_WRITE : 0), MAP_SHARED, file, 0);
+
+            if (address == MAP_FAILED)
+            {
+                throw std::system_error(errno, std::system_category(), "file cannot be mapped.");
+            }
+
+            data = static_cast<std::byte*>(address);
+            #endif//_WIN32
+        }
+
+        void unmap  () noexcept
+        {
+            #ifdef  _WIN32
+            if (data != nullptr)
+            {
+                UnmapViewOfFile(data);
+            }
+
+            if (mapping != nullptr)
+            {
+                CloseHandle(mapping);
+            }
+
+            mapping = nullptr;
+            #else
+            if (data != nullptr)
+            {
+                ::munmap(data, size);
+            }
+            #endif//_WIN32
+
+            data = nullptr;
+        }
+
+        void close  () noexcept
+        {
+            #ifdef  _WIN32
+            if (file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(file);
+            }
+
+            file = INVALID_HANDLE_VALUE;
+            #else
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+
+            file = -1;
+            #endif//_WIN32
+        }
+    };
+
+    namespace detail
+    {
+        // the magnitude of a view, borrowed from the buffer when it is non-negative and limb aligned, copied otherwise.
+        struct ViewMagnitude final
+        {
+            Nat                    copy;
+
+            std::span<const Limb>  limbs;
+
+            bool                   isNegative = false;
+
+            ViewMagnitude(const ViewMagnitude&) = delete;
+
+            auto operator=(const ViewMagnitude&) -> ViewMagnitude& = delete;
+
+            explicit ViewMagnitude(const BigIntView& view):
+                isNegative(view.is_negative())
+            {
+                if (auto borrowed = view.limbs(); borrowed && !isNegative)
+                {
+                    limbs = *borrowed;
+                }
+                else
+                {
+                    copy.resize(view.limb_count());
+
+                    for (auto i = 0zu; i < copy.size(); i++)
+                    {
+                        copy[i] = isNegative ? ~view.limb(i) : view.limb(i);
+                    }
+
+                    if (isNegative)
+                    {
+                        copy.push_back(0);
+
+                        add_1(copy.data(), copy.data(), copy.size(), 1);
+                    }
+
+                    limbs = copy;
+                }
+
+                limbs = limbs.first(normalized_size(limbs.data(), limbs.size()));
+            }
+        };
+
+        // the number of limbs the two's complement value in rp needs, at least one.
+        inline auto signed_size(const Limb* rp, std::size_t n) noexcept -> std::size_t
+        {
+            for (; n > 1 && rp[n - 1] == (static_cast<std::make_signed_t<Limb>>(rp[n - 2]) < 0 ? ~Limb(0) : Limb(0));)
+            {
+                n--;
+            }
+
+            return n;
+        }
+    }
+
+    // a BigInt stored in the prefixed format of BigInt::to_prefixed_bytes in a mapped file. Read-only operands are used
+    // in place and results are computed straight into the mapping of the output file, so neither has to fit in memory.
+    // The output is written next to its path and renamed over it when complete, so it may be the file of an operand. On
+    // Windows the rename fails while that file is still mapped.
+    struct MappedBigInt final
+    {
+        private:
+        using Limb = detail::Limb;
+
+        private:
+        MappedFile file;
+
+        public:
+        MappedBigInt() = default;
+
+        static auto open  (const std::filesystem::path& path) -> MappedBigInt
+        {
+            auto ret = MappedBigInt();
+
+            ret.file = MappedFile::open(path);
+
+            ret.view();
+
+            return ret;
+        }
+
+        static auto create(const std::filesystem::path& path, const BigInt& value) -> MappedBigInt
+        {
+            const auto bytes = value.to_prefixed_bytes();
+
+            return produce(path, bytes.size(), [&](MappedFile& file_)
+                           {
+                               std::copy(bytes.begin(), bytes.end(), file_.bytes().begin());
+                           });
+        }
+
+        // lhs + rhs written to a new file at path.
+        static auto add   (const std::filesystem::path& path, const BigIntView& lhs, const BigIntView& rhs) -> MappedBigInt
+        {
+            const auto size = std::max(lhs.limb_count(), rhs.limb_count()) + 1;
+
+            return produce(path, payloadOffset(size), [&](MappedFile& file_)
+                           {
+                               const auto rp_ = limbs(file_);
+
+                               auto carry_ = Limb(0);
+
+                               for (auto i = 0zu; i < size; i++)
+                               {
+                                   rp_[i] = detail::add_with_carry(lhs.limb(i), rhs.limb(i), carry_);
+                               }
+
+                               finish(file_, rp_, size);
+                           });
+        }
+
+        // lhs * rhs written to a new file at path.
+        static auto mul   (const std::filesystem::path& path, const BigIntView& lhs, const BigIntView& rhs) -> MappedBigInt
+        {
+            const auto lhsMagnitude = detail::ViewMagnitude(lhs);
+            const auto rhsMagnitude = detail::ViewMagnitude(rhs);
+
+            const auto an = lhsMagnitude.limbs.size();
+            const auto bn = rhsMagnitude.limbs.size();
+
+            const auto size = an + bn + 1;
+
+            return produce(path, payloadOffset(size), [&](MappedFile& file_)
+                           {
+                               const auto rp_ = limbs(file_);
+
+                               std::fill(rp_, rp_ + size, Limb(0));
+
+                               if (an > 0 && bn > 0)
+                               {
+                                   detail::mul(rp_, lhsMagnitude.limbs.data(), an, rhsMagnitude.limbs.data(), bn);
+                               }
+
+                               if (lhsMagnitude.isNegative != rhsMagnitude.isNegative)
+                               {
+                                   for (auto i = 0zu; i < size; i++)
+                                   {
+                                       rp_[i] = ~rp_[i];
+                                   }
+
+                                   detail::add_1(rp_, rp_, size, 1);
+                               }
+
+                               finish(file_, rp_, size);
+                           });
+        }
+
+        public:
+        auto view    () const -> BigIntView
+        {
+            auto bytes = file.bytes();
+
+            return BigIntView::from_prefixed_bytes(bytes);
+        }
+
+        auto ToBigInt() const -> BigInt
+        {
+            return view().ToBigInt();
+        }
+
+        explicit operator BigInt() const
+        {
+            return ToBigInt();
+        }
+
+        operator BigIntView() const
+        {
+            return view();
+        }
+
+        private:
+        // the payload follows the 8-byte count and is padded to whole 64-bit words.
+        static auto payloadOffset(std::size_t limbCount) noexcept -> std::size_t
+        {
+            return detail::PrefixBytes + (limbCount * sizeof(Limb) + 7) / 8 * 8;
+        }
+
+        // fills a new file of size bytes next to path with func and only then renames it over path, so path may be the
+        // file behind an operand: the operand keeps reading the old file, which goes away when its mapping is closed.
+        template<class F>
+        static auto produce(const std::filesystem::path& path, std::size_t size, const F& func) -> MappedBigInt
+        {
+            auto temporary = path;
+
+            temporary += ".tmp";
+
+            try
+            {
+                auto output = MappedFile::create(temporary, size);
+
+                func(output);
+
+                output = MappedFile();
+
+                std::filesystem::rename(temporary, path);
+            }
+            catch (...)
+            {
+                auto error = std::error_code();
+
+                std::filesystem::remove(temporary, error);
+
+                throw;
+            }
+
+            return open(path);
+        }
+
+        // the payload of a freshly created file as limbs, the mapping is page aligned and the count is 8 bytes.
+        static auto limbs  (MappedFile& output) noexcept -> Limb*
+        {
+            return reinterpret_cast<Limb*>(output.bytes().data() + detail::PrefixBytes);
+        }
+
+        // trims the result in rp, which already sits in the payload, pads it to whole words, then writes the count
+        // and shrinks the file to fit.
+        static void finish (MappedFile& output, Limb* rp, std::size_t size)
+        {
+            const auto count = detail::signed_size(rp, size);
+
+            const auto payloadSize = payloadOffset(count) - detail::PrefixBytes;
+
+            auto bytes = output.bytes();
+
+            const auto payload = bytes.subspan(detail::PrefixBytes, payloadSize);
+
+            if constexpr (std::endian::native != std::endian::little)
+            {
+                for (auto i = 0zu; i < count; i++)
+                {
+                    std::reverse(payload.begin() + static_cast<std::ptrdiff_t>(i * sizeof(Limb)),
+                                 payload.begin() + static_cast<std::ptrdiff_t>(i * sizeof(Limb) + sizeof(Limb)));
+                }
+            }
+
+            const auto fill = static_cast<std::make_signed_t<Limb>>(rp[count - 1]) < 0 ? std::byte(0xFF) : std::byte(0);
+
+            std::fill(payload.begin() + static_cast<std::ptrdiff_t>(count * sizeof(Limb)), payload.end(), fill);
+
+            for (auto i = 0zu; i < detail::PrefixBytes; i++)
+            {
+                bytes[i] = static_cast<std::byte>(static_cast<std::uint64_t>(payloadSize) >> (i * 8));
+            }
+
+            output.resize(detail::PrefixBytes + payloadSize);
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+namespace akr::test
+{
+    #ifdef  _WIN32
+    constexpr auto CanReplaceMappedFile = false;
+    #else
+    constexpr auto CanReplaceMappedFile = true;
+    #endif//_WIN32
+
+    AKR_TEST(MappedBigInt,
+    {
+        const auto directory = std::filesystem::temp_directory_path();
+
+        const auto lhsPath = directory / "akr_mapped_lhs.bin";
+        const auto rhsPath = directory / "akr_mapped_rhs.bin";
+        const auto outPath = directory / "akr_mapped_out.bin";
+
+        for (auto i = 0; i < 12; i++)
+        {
+            const auto a = pow(BigInt(i % 2 == 0 ? 7 : -7), i * 401) - i;
+            const auto b = pow(BigInt(i % 3 == 0 ? -3 : 3), i * 97 + 1) + i;
+
+            {
+                const auto lhs = MappedBigInt::create(lhsPath, a);
+                const auto rhs = MappedBigInt::create(rhsPath, b);
+
+                assert(lhs.ToBigInt() == a && lhs.view() == a && (lhs.view() < rhs.view()) == (a < b));
+            }
+
+            const auto lhs = MappedBigInt::open(lhsPath);
+            const auto rhs = MappedBigInt::open(rhsPath);
+
+            assert(MappedBigInt::add(outPath, lhs, rhs).ToBigInt() == a + b);
+            assert(MappedBigInt::open(outPath).view() == a + b);
+
+            assert(MappedBigInt::mul(outPath, lhs, rhs).ToBigInt() == a * b);
+            assert(MappedBigInt::open(outPath).view() == a * b);
+
+            const auto bytes = a.to_bytes(std::endian::big);
+
+            assert(MappedBigInt::mul(outPath, BigIntView(bytes, std::endian::big), rhs).view() == a * b);
+        }
+
+        assert(MappedBigInt::add(outPath, MappedBigInt::create(lhsPath, -1), MappedBigInt::create(rhsPath, 1)).view() == 0);
+        assert(MappedBigInt::mul(outPath, MappedBigInt::open(lhsPath), MappedBigInt::open(lhsPath)).view() == 1);
+
+        if (CanReplaceMappedFile)
+        {
+            const auto a = pow(BigInt(3), 5000);
+
+            const auto lhs = MappedBigInt::create(lhsPath, a);
+
+            const auto sum     = MappedBigInt::add(lhsPath, lhs, lhs);
+            const auto product = MappedBigInt::mul(lhsPath, lhs, sum);
+
+            assert(lhs.view() == a && sum.view() == a * 2 && product.view() == a * a * 2);
+            assert(MappedBigInt::open(lhsPath).view() == a * a * 2 && !std::filesystem::exists(lhsPath.string() + ".tmp"));
+        }
+
+        std::filesystem::remove(lhsPath);
+        std::filesystem::remove(rhsPath);
+        std::filesystem::remove(outPath);
+    });
+}
+#endif//D_AKR_TEST
+
+#endif//Z_AKR_MAPPEDBIGINT_HH
@@ -2,6 +2,10 @@
 #include "akr_test.hh"
 
 #include "..\bigint.hh"
+#include "..\fixedint.hh"
+#include "..\mappedbigint.hh"
+#include "..\bigrational.hh"
+#include "..\bigdecimalint.hh"
 
 #include <chrono>
 #include <iostream>
@@ -0,0 +1,219 @@
+// measures where the algorithms of bigint.hh cross over on this host and writes them to bigint_tuning.hh,
+// which bigint.hh includes when it sits next to it.
+//
+//   build.bat g++ -O2
+//   out\bigint_tuneg++-O2.exe [output path, ..\bigint_tuning.hh by default]
+
+#include "../bigint.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+
+using namespace akr;
+
+namespace
+{
+    auto re = std::mt19937_64(2022);
+
+    auto RandomLimbs(std::size_t n) -> detail::Nat
+    {
+        auto ret = detail::BigIntAccess::magnitude(random_bits(re, n * detail::LimbBits));
+
+        ret.resize(n);
+
+        ret.back() |= detail::Limb(1) << (detail::LimbBits - 1);
+
+        return ret;
+    }
+
+    // the seconds one call of func takes, the best of several runs that each last at least a millisecond.
+    auto Measure(const std::function<void()>& func) -> double
+    {
+        using namespace std::chrono;
+
+        auto best = 1e300;
+
+        for (auto run = 0; run < 5; run++)
+        {
+            for (auto count = 1zu;; count *= 2)
+            {
+                const auto t1 = steady_clock::now();
+
+                for (auto i = 0zu; i < count; i++)
+                {
+                    func();
+                }
+
+                const auto t2 = steady_clock::now();
+
+                if (const auto elapsed = duration<double>(t2 - t1).count(); elapsed >= 1e-3)
+                {
+                    best = std::min(best, elapsed / static_cast<double>(count));
+
+                    break;
+                }
+            }
+        }
+
+        return best;
+    }
+
+    // the first size from which the threshold pays off three sizes in a row. time(size) runs the operation on
+    // operands of that size, once with the threshold just above it and once with the threshold at it.
+    auto Crossover(const char* name, std::size_t first, std::size_t last, std::size_t step,
+                   std::size_t Thresholds::*member, const std::function<void(std::size_t)>& run) -> std::size_t
+    {
+        const auto saved = thresholds();
+
+        auto wins = 0zu;
+
+        auto ret = last;
+
+        for (auto size = first; size <= last; size += step)
+        {
+            auto values = saved;
+
+            values.*member = size + 1;
+
+            set_thresholds(values);
+
+            const auto slow = Measure([&] { run(size); });
+
+            values.*member = size;
+
+            set_thresholds(values);
+
+            const auto fast = Measure([&] { run(size); });
+
+            std::printf("%-14s %5zu limbs: %10.3fus %10.3fus\n", name, size, slow * 1e6, fast * 1e6);
+
+            wins = fast < slow ? wins + 1 : 0;
+
+            if (wins == 3)
+            {
+                ret = size - step * 2;
+
+                break;
+            }
+        }
+
+        set_thresholds(saved);
+
+        std::printf("%-14s %5zu\n", name, ret);
+
+        return ret;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const auto path = std::string(argc > 1 ? argv[1] : "../bigint_tuning.hh");
+
+    std::printf("kernels: %s\n", std::string(active_kernels()).c_str());
+
+    auto tuned = thresholds();
+
+    tuned.mulKaratsuba = Crossover("mulKaratsuba", 8, 128, 2, &Thresholds::mulKaratsuba, [](std::size_t size_)
+                                   {
+                                       static auto a_ = detail::Nat();
+                                       static auto b_ = detail::Nat();
+                                       static auto r_ = detail::Nat();
+
+                                       if (a_.size() != size_)
+                                       {
+                                           a_ = RandomLimbs(size_);
+                                           b_ = RandomLimbs(size_);
+                                           r_ = detail::Nat(size_ * 2);
+                                       }
+
+                                       detail::mul(r_.data(), a_.data(), size_, b_.data(), size_);
+                                   });
+
+    set_thresholds(tuned);
+
+    tuned.mulToom      = Crossover("mulToom",      64, 1024, 32, &Thresholds::mulToom,      [](std::size_t size_)
+                                   {
+                                       static auto a_ = detail::Nat();
+                                       static auto b_ = detail::Nat();
+                                       static auto r_ = detail::Nat();
+
+                                       if (b_.size() != size_)
+                                       {
+                                           a_ = RandomLimbs(size_ * 3 / 2);
+                                           b_ = RandomLimbs(size_);
+                                           r_ = detail::Nat(a_.size() + b_.size());
+                                       }
+
+                                       detail::mul(r_.data(), a_.data(), a_.size(), b_.data(), b_.size());
+                                   });
+
+    set_thresholds(tuned);
+
+    tuned.divRecursive = Crossover("divRecursive", 8, 256, 4, &Thresholds::divRecursive, [](std::size_t size_)
+                                   {
+                                       static auto a_ = detail::Nat();
+                                       static auto b_ = detail::Nat();
+
+                                       if (b_.size() != size_)
+                                       {
+                                           a_ = RandomLimbs(size_ * 2);
+                                           b_ = RandomLimbs(size_);
+                                       }
+
+                                       auto q_ = detail::Nat();
+                                       auto r_ = detail::Nat();
+
+                                       detail::div_qr(q_, r_, a_, b_);
+                                   });
+
+    set_thresholds(tuned);
+
+    tuned.radixDivide  = Crossover("radixDivide",  4, 256, 4, &Thresholds::radixDivide,  [](std::size_t size_)
+                                   {
+                                       static auto x_ = BigInt();
+
+                                       if (x_.bit_length() != size_ * detail::LimbBits)
+                                       {
+                                           x_ = detail::BigIntAccess::fromMagnitude(RandomLimbs(size_), false);
+                                       }
+
+                                       x_.ToStdString();
+                                   });
+
+    auto file = std::ofstream(path);
+
+    // each define gives way to one already made, such as a -D on the command line.
+    const auto define = [&file](const char* name_, std::size_t value_)
+    {
+        file << "#ifndef " << name_ << "\n"
+                "#define " << name_ << " " << value_ << "\n"
+                "#endif//" << name_ << "\n";
+    };
+
+    file << "#ifndef Z_AKR_BIGINT_TUNING_HH\n"
+            "#define Z_AKR_BIGINT_TUNING_HH\n"
+            "\n"
+            "// written by tune/bigint_tune for one host, run it again rather than editing.\n";
+
+    define("D_AKR_BIGINT_MUL_KARATSUBA", tuned.mulKaratsuba);
+    define("D_AKR_BIGINT_MUL_TOOM",      tuned.mulToom);
+    define("D_AKR_BIGINT_DIV_RECURSIVE", tuned.divRecursive);
+    define("D_AKR_BIGINT_RADIX_DIVIDE",  tuned.radixDivide);
+
+    file << "\n"
+            "#endif//Z_AKR_BIGINT_TUNING_HH\n";
+
+    if (!file)
+    {
+        std::fprintf(stderr, "%s cannot be written.\n", path.c_str());
+
+        return 1;
+    }
+
+    std::printf("written to %s\n", path.c_str());
+}
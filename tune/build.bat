@@ -0,0 +1 @@
+%1 "bigint_tune.cc" -o"./out/bigint_tune%1%2.exe" -Wall -Wextra -std="c++2b" %2